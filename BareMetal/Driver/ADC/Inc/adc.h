@@ -16,40 +16,67 @@
 // Wait time for stabilize (tSTAB)
 #define ADC_ON_DELAY						((uint16_t) 10)
 
-// ADC Channel Sequence
+// ADC Regular Sequence (SQR1 - SQR3)
 typedef struct {
-	// Channel Sequence 1
-	uint8_t channel_seq_1;
-	// Channel Sequence 2
-	uint8_t channel_seq_2;
-	// Channel Sequence 3
-	uint8_t channel_seq_3;
-	// Channel Sequence 4
-	uint8_t channel_seq_4;
-	// Channel Sequence 5
-	uint8_t channel_seq_5;
-	// Channel Sequence 6
-	uint8_t channel_seq_6;
-	// Channel Sequence 7
-	uint8_t channel_seq_7;
-	// Channel Sequence 8
-	uint8_t channel_seq_8;
-	// Channel Sequence 9
-	uint8_t channel_seq_9;
-	// Channel Sequence 10
-	uint8_t channel_seq_10;
-	// Channel Sequence 11
-	uint8_t channel_seq_11;
-	// Channel Sequence 12
-	uint8_t channel_seq_12;
+	// Channels in conversion order: `ADC_CHANNEL_0` - `ADC_CHANNEL_17` (a channel may appear more than once)
+	uint8_t channel[ADC_MAX_SEQUENCE];
+	// Sample Time of each entry: `ADC_SAMPLE_1_5` - `ADC_SAMPLE_239_5`
+	// SMPR1/SMPR2 hold one Sample Time per channel: a repeated channel uses its last entry
+	uint8_t sample_time[ADC_MAX_SEQUENCE];
+	// Number of conversions (1 - `ADC_MAX_SEQUENCE`)
+	uint8_t length;
 } adc_sequence_t;
 
+// "ADC_Injected_Callback_t" is now a type representing:
+// "Pointer to any function taking ADC Instance, Injected results (`JDRx`, offset removed), Number of results and returning void"
+typedef void (*ADC_Injected_Callback_t)(ADC_REG_STRUCT* ADCx, const int16_t* data, uint8_t count);
+
+// ADC Injected Group (JSQR, JOFR1 - JOFR4)
+typedef struct {
+	// Channels in conversion order: `ADC_CHANNEL_0` - `ADC_CHANNEL_17`
+	uint8_t channel[ADC_MAX_INJECTED];
+	// Sample Time of each entry: `ADC_SAMPLE_1_5` - `ADC_SAMPLE_239_5` (shared with the Regular Sequence per channel)
+	uint8_t sample_time[ADC_MAX_INJECTED];
+	// Offset of each entry (0 - `MAX_ADC_VALUE`): `JDRx = result - offset` (signed, right aligned)
+	uint16_t offset[ADC_MAX_INJECTED];
+	// Number of conversions (1 - `ADC_MAX_INJECTED`)
+	uint8_t length;
+	// Trigger: `ADC_JEXTSEL_TIM1_TRGO` - `ADC_JEXTSEL_JSWSTART`
+	uint8_t trigger;
+	// JEOC Callback (executed in interrupt context), `NULL`: poll with `ADC_Get_Injected_Data()`
+	ADC_Injected_Callback_t callback;
+} adc_injected_t;
+
+// "ADC_Watchdog_Callback_t" is now a type representing:
+// "Pointer to any function taking ADC Instance and returning void"
+typedef void (*ADC_Watchdog_Callback_t)(ADC_REG_STRUCT* ADCx);
+
+// ADC Analog Watchdog (HTR/LTR, CR1 AWDEN/JAWDEN/AWDSGL/AWDCH/AWDIE)
+typedef struct {
+	// High Threshold (0 - `MAX_ADC_VALUE`), compared to the raw 12-bit result (before alignment/offset)
+	uint16_t high;
+	// Low Threshold (0 - `high`)
+	uint16_t low;
+	// Guarded Groups: `ADC_AWD_GROUP_REGULAR`, `ADC_AWD_GROUP_INJECTED`, `ADC_AWD_GROUP_ALL`
+	uint8_t groups;
+	// Guarded Channel: `ADC_CHANNEL_0` - `ADC_CHANNEL_17`, `ADC_AWD_ALL_CHANNELS`
+	uint8_t channel;
+	// Out of window Callback (executed in interrupt context, one shot: `ADC_Watchdog_Arm()` re-arms)
+	ADC_Watchdog_Callback_t callback;
+} adc_watchdog_t;
+
 // ADC Configuration Structure
 typedef struct {
 	// GPIO Configuration
 	gpio_config_t* GPIOx_CONFIG;
 	// ADC Number
 	ADC_REG_STRUCT* ADCx;
+	// Regular Sequence (Scan Mode), `NULL`: single `channel` conversion
+	adc_sequence_t* sequence;
+	// Injected Group, `NULL`: not used
+	adc_injected_t* injected;
+	// Analog Watchdog, `NULL`: not used
+	adc_watchdog_t* watchdog;
 	// ADC Channel
 	uint8_t channel;
 	// Number of Channels
@@ -126,10 +153,10 @@ __STATIC_INLINE__ void ADC_calibrate(ADC_REG_STRUCT* ADCx){
 }
 
 /**
- * @brief Starts the ADC based upon the sequence
+ * @brief Powers up & calibrates the ADC without starting a conversion
  * @param[in] ADCx `ADC1`, `ADC2`, `ADC3`
  */
-__STATIC_INLINE__ void ADC_start(ADC_REG_STRUCT* ADCx){
+__STATIC_INLINE__ void ADC_power_on(ADC_REG_STRUCT* ADCx){
 	// When the ADON bit is set for the first time, it wakes up the ADC from Power Down mode
 	// If this bit holds a value of 0 and a 1 is written to it then it wakes up the ADC from Power Down state
 	ADC_enable(ADCx);
@@ -137,6 +164,15 @@ __STATIC_INLINE__ void ADC_start(ADC_REG_STRUCT* ADCx){
 	for(volatile uint16_t tSTAB_delay = 0; tSTAB_delay <= ADC_ON_DELAY; tSTAB_delay++);
 	// Calibrate the ADC
 	ADC_calibrate(ADCx);
+}
+
+/**
+ * @brief Starts the ADC based upon the sequence
+ * @param[in] ADCx `ADC1`, `ADC2`, `ADC3`
+ */
+__STATIC_INLINE__ void ADC_start(ADC_REG_STRUCT* ADCx){
+	// Power up & Calibrate
+	ADC_power_on(ADCx);
 	// Conversion starts when ADON bit is set for a second time by software after ADC power-up time (tSTAB)
 	// Conversion starts when this bit holds a value of 1 and a 1 is written to it
 	ADC_enable(ADCx);
@@ -163,8 +199,190 @@ __STATIC_INLINE__ void ADC_clear_EOC_flag(ADC_REG_STRUCT* ADCx){
  }
 
 /**
- * @brief Enables the ADC Clock
+ * @brief Starts a regular conversion (Scan) by software
+ * @param[in] ADCx `ADC1`, `ADC2`, `ADC3`
+ * @note Requires the `ADC_EXTSEL_SWSTART` trigger (set by `ADC_config()` in Scan Mode)
+ */
+__STATIC_INLINE__ void ADC_Software_Trigger(ADC_REG_STRUCT* ADCx){
+	// Start the Regular Group
+	ADCx->CR2.REG |= ADC_CR2_SWSTART;
+}
+
+/**
+ * @brief Writes the Control Register 2 (CR2) without starting a conversion
+ * @param[in] ADCx `ADC1`, `ADC2`, `ADC3`
+ * @param[in] value New CR2 value
+ * @note With ADON set, a write that changes no other bit starts a conversion: unchanged values are skipped
+ */
+__STATIC_INLINE__ void ADC_Write_CR2(ADC_REG_STRUCT* ADCx, uint32_t value){
+	// Only a real change reaches the register
+	if(ADCx->CR2.REG != value)
+		ADCx->CR2.REG = value;
+}
+
+/**
+ * @brief Selects the trigger of the Regular Group (EXTSEL)
+ * @param[in] ADCx `ADC1`, `ADC2`
+ * @param[in] extsel `ADC_EXTSEL_TIM1_CC1` - `ADC_EXTSEL_SWSTART`
+ * @note A rising edge of the selected event starts one conversion (Scan Mode: the whole sequence)
+ */
+__STATIC_INLINE__ void ADC_Set_External_Trigger(ADC_REG_STRUCT* ADCx, uint8_t extsel){
+	// Local Variable
+	uint32_t reg = ADCx->CR2.REG;
+	// Trigger Source
+	reg &= ~ADC_CR2_EXTSEL_Msk;
+	reg |= ((uint32_t)(extsel & 0x07) << ADC_CR2_EXTSEL_Pos);
+	// External Trigger Enable
+	reg |= ADC_CR2_EXTTRIG;
+	// Write to the register
+	ADC_Write_CR2(ADCx, reg);
+}
+
+/**
+ * @brief Starts the Injected Group by software
+ * @param[in] ADCx `ADC1`, `ADC2`, `ADC3`
+ * @note Requires the `ADC_JEXTSEL_JSWSTART` trigger, an ongoing regular conversion is interrupted
+ */
+__STATIC_INLINE__ void ADC_Injected_Software_Trigger(ADC_REG_STRUCT* ADCx){
+	// Start the Injected Group
+	ADCx->CR2.REG |= ADC_CR2_JSWSTART;
+}
+
+/**
+ * @brief Retrieves an Injected result
+ * @param[in] ADCx `ADC1`, `ADC2`, `ADC3`
+ * @param[in] rank Conversion order (0 - `length - 1`)
+ * @returns Result minus the rank offset (JDRx, sign extended)
+ */
+__STATIC_INLINE__ int16_t ADC_Get_Injected_Data(ADC_REG_STRUCT* ADCx, uint8_t rank){
+	// JDR1 - JDR4 are consecutive
+	return (int16_t)((&ADCx->JDR1.REG)[rank & 0x03] & 0xFFFF);
+}
+
+/**
+ * @brief Sets the Sample Time of a channel (SMPR1/SMPR2)
+ * @param[in] ADCx `ADC1`, `ADC2`, `ADC3`
+ * @param[in] channel `ADC_CHANNEL_0` - `ADC_CHANNEL_17`
+ * @param[in] sample_time `ADC_SAMPLE_1_5` - `ADC_SAMPLE_239_5`
+ */
+__STATIC_INLINE__ void ADC_Set_Sample_Time(ADC_REG_STRUCT* ADCx, uint8_t channel, uint8_t sample_time){
+	// Channels 10 - 17: SMPR1
+	if(channel >= 10){
+		ADCx->SMPR1.REG &= ~(0x07UL << ((channel - 10) * 3));
+		ADCx->SMPR1.REG |= ((uint32_t)(sample_time & 0x07) << ((channel - 10) * 3));
+	}
+	// Channels 0 - 9: SMPR2
+	else{
+		ADCx->SMPR2.REG &= ~(0x07UL << (channel * 3));
+		ADCx->SMPR2.REG |= ((uint32_t)(sample_time & 0x07) << (channel * 3));
+	}
+}
+
+/**
+ * @brief Programs the Regular Sequence (SQR1 - SQR3) & the Sample Times (SMPR1/SMPR2)
+ * @param[in] ADCx `ADC1`, `ADC2`, `ADC3`
+ * @param[in] sequence Regular Sequence
+ * @returns - `0x00`: Failure (Empty/Too long sequence/Invalid channel)
+ * @returns - `0x01`: Success
+ */
+uint8_t ADC_Set_Sequence(ADC_REG_STRUCT* ADCx, const adc_sequence_t* sequence);
+
+/**
+ * @brief Programs the Injected Group (JSQR, JOFRx, JEXTSEL) & its JEOC Callback
+ * @param[in] ADCx `ADC1`, `ADC2`
+ * @param[in] injected Injected Group
+ * @returns - `0x00`: Failure (Not ADC1/ADC2/Empty/Too long group/Invalid channel)
+ * @returns - `0x01`: Success
+ * @note A group of more than one conversion sets SCAN (shared with the Regular Group)
+ */
+uint8_t ADC_Set_Injected(ADC_REG_STRUCT* ADCx, const adc_injected_t* injected);
+
+/**
+ * @brief Programs the Analog Watchdog (HTR/LTR, guarded groups & channel) & its Callback
+ * @param[in] ADCx `ADC1`, `ADC2`
+ * @param[in] watchdog Analog Watchdog
+ * @returns - `0x00`: Failure (Not ADC1/ADC2/Invalid thresholds/channel)
+ * @returns - `0x01`: Success
+ * @note The comparison runs in hardware on every conversion: no CPU is used until a result leaves the window
+ */
+uint8_t ADC_Set_Watchdog(ADC_REG_STRUCT* ADCx, const adc_watchdog_t* watchdog);
+
+/**
+ * @brief Re-arms the Analog Watchdog Interrupt after a callback
+ * @param[in] ADCx `ADC1`, `ADC2`
+ * @note Re-arming while the input is still outside the window calls the callback again at the next conversion
+ */
+__STATIC_INLINE__ void ADC_Watchdog_Arm(ADC_REG_STRUCT* ADCx){
+	// Clear the latched event (rc_w0: writing 1 leaves the other flags untouched)
+	ADCx->SR.REG = ~(uint32_t)ADC_SR_AWD;
+	// Enable the Interrupt
+	ADCx->CR1.REG |= ADC_CR1_AWDIE;
+}
+
+/**
+ * @brief Moves the Analog Watchdog window (e.g. hysteresis from the callback)
+ * @param[in] ADCx `ADC1`, `ADC2`
+ * @param[in] high High Threshold (0 - `MAX_ADC_VALUE`)
+ * @param[in] low Low Threshold (0 - `high`)
+ */
+__STATIC_INLINE__ void ADC_Watchdog_Set_Thresholds(ADC_REG_STRUCT* ADCx, uint16_t high, uint16_t low){
+	// 12-bit Thresholds
+	ADCx->HTR.REG = (high & MAX_ADC_VALUE);
+	ADCx->LTR.REG = (low & MAX_ADC_VALUE);
+}
+
+/**
+ * @brief Converts a raw result to millivolts against VREFINT (ratiometric)
+ * @param[in] raw 12-bit right aligned result
+ * @param[in] vrefint_raw VREFINT (`ADC_CHANNEL_VREFINT`) result from the same supply
+ * @returns Input voltage (in mV), 0 if `vrefint_raw` is 0
+ * @note VDDA drops out: `mV = raw * VREFINT / vrefint_raw`, no external reference needed
+ */
+__STATIC_INLINE__ uint16_t ADC_Raw_To_mV(uint16_t raw, uint16_t vrefint_raw){
+	// No reference reading
+	if(vrefint_raw == 0)
+		return 0;
+	// Rounded integer ratio (4095 * 1200 fits in 32 bits)
+	return (uint16_t)((((uint32_t)raw * ADC_VREFINT_mV) + (vrefint_raw >> 1)) / vrefint_raw);
+}
+
+/**
+ * @brief Computes the Analog Supply (VDDA) from a VREFINT result
+ * @param[in] vrefint_raw VREFINT (`ADC_CHANNEL_VREFINT`) result
+ * @returns VDDA (in mV), 0 if `vrefint_raw` is 0
+ */
+__STATIC_INLINE__ uint16_t ADC_Get_VDDA_mV(uint16_t vrefint_raw){
+	// Full scale in mV
+	return ADC_Raw_To_mV(MAX_ADC_VALUE, vrefint_raw);
+}
+
+/**
+ * @brief Converts a Temperature Sensor result to temperature
+ * @param[in] temp_raw Temperature Sensor (`ADC_CHANNEL_TEMPSENSOR`) result
+ * @param[in] vrefint_raw VREFINT (`ADC_CHANNEL_VREFINT`) result from the same supply
+ * @returns Temperature (in 0.01 degC)
+ * @note Typical V25/Avg Slope: the absolute error is a few degC unless calibrated, the variation is accurate
+ */
+int32_t ADC_Get_Temperature(uint16_t temp_raw, uint16_t vrefint_raw);
+
+/**
+ * @brief Converts a scan to millivolts with the VREFINT rank of the same scan
+ * @param[in] sequence Regular Sequence of the scan (must contain `ADC_CHANNEL_VREFINT`)
+ * @param[in] data Scan results, one per rank
+ * @param[out] mV Voltages, one per rank (may alias `data`)
+ * @returns - `0x00`: Failure (No VREFINT rank/VREFINT reads 0)
+ * @returns - `0x01`: Success
+ */
+uint8_t ADC_Scan_To_mV(const adc_sequence_t* sequence, const uint16_t* data, uint16_t* mV);
+
+/**
+ * @brief Configures the ADC based upon ADC Configuration Structure
  * @param[in] ADC_CONFIGx ADC configuration structure
+ * @note - Single channel (`sequence == NULL`): conversions start immediately
+ * @note - Scan Mode (`sequence != NULL`): the ADC is powered & calibrated, conversions start on `ADC_Software_Trigger()`
+ * @note - Injected Group (`injected != NULL`): converted on its own trigger, interrupting the Regular Group
+ * @note - Analog Watchdog (`watchdog != NULL`): guards the results in hardware
+ * @note - `ADC_CHANNEL_TEMPSENSOR`/`ADC_CHANNEL_VREFINT` (ADC1) enable TSVREFE, use `ADC_SAMPLE_239_5` (>= 17.1 us)
  */
 void ADC_config(adc_config_t* ADC_CONFIGx);
 
@@ -205,6 +423,7 @@ uint16_t ADC_get_data(adc_config_t* ADC_CONFIGx);
 
 /**
  * @brief ADC1/ADC2 IRQ Handler
+ * @note Services the Injected Group & the Analog Watchdog, an EOC Interrupt (`enable_IRQ`) is left to an application handler
  */
 void ADC1_2_IRQHandler(void);
 
@@ -222,6 +441,12 @@ __STATIC_INLINE__ void ADC_load_default(adc_config_t* ADC_CONFIGx){
 	// Configure GPIO Mode and Configuration
 	ADC_CONFIGx->GPIOx_CONFIG->MODE = GPIOx_MODE_IN;
 	ADC_CONFIGx->GPIOx_CONFIG->CNF = GPIOx_CNF_IN_ANALOG;
+	// Single Channel
+	ADC_CONFIGx->sequence = NULL;
+	// No Injected Group
+	ADC_CONFIGx->injected = NULL;
+	// No Analog Watchdog
+	ADC_CONFIGx->watchdog = NULL;
 	// Number of Channels as 1
 	ADC_CONFIGx->num_channels = 1;
 	// Sample Time as 239.5 cycles
@@ -0,0 +1,110 @@
+// Header Guards
+#ifndef __ADC_DMA_H__
+#define __ADC_DMA_H__
+
+// Address Mapping
+#include "reg_map.h"
+// ADC Configuration
+#include "adc.h"
+// DMA Channel Manager
+#include "dma.h"
+// Circular Double Buffer
+#include "dma_stream.h"
+// Trigger Timer
+#include "timer.h"
+
+/**
+ ** ADC Scan with DMA:
+ * - One trigger converts every entry of the Regular Sequence, the DMA (`DMA1_Channel1`) moves each
+ * 	 result from ADC1->DR into `buffer[rank]` (`uint16_t` per conversion)
+ * - The DMA is circular over one scan: it re-arms by itself, so every scan lands at `buffer[0]`
+ * - The Scan Callback runs on DMA Transfer Complete (whole sequence converted), no CPU per conversion
+ * - Only ADC1 has a DMA request: ADC2 results are read through ADC1 in dual mode
+ *
+ ** Timer Triggered Stream:
+ * - A General Purpose Timer fires one scan per period through EXTSEL, the sample instants follow the
+ * 	 timer clock only (no software in the trigger path, no jitter from the main loop)
+ * 	 |--- `TIM2`: CC2 event (PWM Mode 1, CCR2 = ARR / 2), `ADC_EXTSEL_TIM2_CC2`
+ * 	 |--- `TIM3`: TRGO on update (MMS = `TIMx_MMS_UPDATE`), `ADC_EXTSEL_TIM3_TRGO`
+ * 	 |--- `TIM4`: CC4 event (PWM Mode 1, CCR4 = ARR / 2), `ADC_EXTSEL_TIM4_CC4`
+ * 	 |--- TIM2 TRGO only reaches the Injected Group (JEXTSEL), hence CC2 for the Regular Group
+ * - Results stream into a circular double buffer (`dma_stream_t`): the callback gets the finished half
+ * 	 (whole scans) while the DMA fills the other half
+ * - Rate: 1 Hz (PSC/ARR at 72 MHz: 1098/65513) up to the conversion time limit
+ * 	 |--- Conversion time = (Sample Time + 12.5) ADC clock cycles per rank
+ * 	 |--- 1 Msps needs ADCCLK = 14 MHz (SYSCLK 56 MHz, ADCPRE /4) and `ADC_SAMPLE_1_5`
+ * 	 |--- At SYSCLK 72 MHz (ADCCLK 12 MHz) the limit is ~857 ksps
+ * 	 |--- A trigger arriving while the scan is still running is ignored by the ADC (rate too high)
+ */
+
+// "ADC_Scan_Callback_t" is now a type representing:
+// "Pointer to any function taking ADC Instance, Status (`ADCx_SCAN_STATUS_DONE`/`ADCx_SCAN_STATUS_ERROR`), Pointer to the results, Number of results and returning void"
+typedef void (*ADC_Scan_Callback_t)(ADC_REG_STRUCT* ADCx, uint8_t status, const uint16_t* data, uint8_t count);
+
+/**
+ * @brief Arms the DMA for the Regular Sequence & starts the first scan
+ * @param[in] ADC_CONFIGx ADC Configuration Structure (configured with a `sequence`)
+ * @param[out] buffer Results, one per rank (`sequence->length` items, must stay valid while armed)
+ * @param[in] callback Scan Callback (executed in interrupt context, may be NULL)
+ * @returns - `0x00`: Failure (Not ADC1/No sequence/DMA Channel owned by another request)
+ * @returns - `0x01`: Success
+ * @note Continuous Conversion (`cc`) repeats the scan back to back, otherwise call `ADC_Software_Trigger()` per scan
+ */
+uint8_t ADC_Scan_DMA_Start(adc_config_t* ADC_CONFIGx, uint16_t* buffer, ADC_Scan_Callback_t callback);
+
+/**
+ * @brief Stops the scans and releases the DMA Channel
+ * @param[in] ADC_CONFIGx ADC Configuration Structure
+ */
+void ADC_Scan_DMA_Stop(adc_config_t* ADC_CONFIGx);
+
+// Forward Declaration
+typedef struct adc_stream adc_stream_t;
+
+// "ADC_Stream_Callback_t" is now a type representing:
+// "Pointer to any function taking ADC Stream, Pointer to the finished half, Number of results in the half and returning void"
+typedef void (*ADC_Stream_Callback_t)(adc_stream_t* stream, const uint16_t* data, uint16_t count);
+
+// ADC Timer Triggered Stream (storage owned by the client while the stream runs)
+struct adc_stream {
+	// ADC Configuration Structure (`ADC1` configured with a `sequence`, `cc` OFF)
+	adc_config_t* ADC_CONFIGx;
+	// Trigger Timer
+	// - `TIM2`
+	// - `TIM3`
+	// - `TIM4`
+	TIM_REG_STRUCT* TIM;
+	// Scan Rate (in Hz), one scan of `sequence->length` conversions per trigger
+	uint32_t rate_Hz;
+	// Double Buffer
+	uint16_t* buffer;
+	// Number of results in `buffer` (multiple of `2 * sequence->length`: each half holds whole scans)
+	uint16_t count;
+	// Half Processing Callback (executed in interrupt context)
+	ADC_Stream_Callback_t callback;
+	// User Context
+	void* context;
+
+	// Internal State (managed by the driver)
+	// Circular DMA (`overrun`/`errors` statistics)
+	dma_stream_t dma;
+	// Achieved Scan Rate (in Hz) after PSC/ARR rounding
+	uint32_t actual_rate_Hz;
+};
+
+/**
+ * @brief Starts a Timer Triggered Stream
+ * @param[in] stream Pointer to the ADC Stream (must stay valid while running)
+ * @returns - `0x00`: Failure (Not ADC1/No sequence/Invalid count/Timer/Rate above Timer Clock/DMA Channel busy)
+ * @returns - `0x01`: Success
+ * @note The Trigger Timer is reconfigured (PSC/ARR/CR2/CCMR), it must not be shared with another function
+ */
+uint8_t ADC_Stream_Start(adc_stream_t* stream);
+
+/**
+ * @brief Stops a Timer Triggered Stream (Timer, ADC DMA Request & DMA Channel)
+ * @param[in] stream Pointer to the ADC Stream
+ */
+void ADC_Stream_Stop(adc_stream_t* stream);
+
+#endif /* __ADC_DMA_H__ */
@@ -0,0 +1,89 @@
+// Header Guards
+#ifndef __ADC_DUAL_H__
+#define __ADC_DUAL_H__
+
+// Address Mapping
+#include "reg_map.h"
+// ADC Configuration
+#include "adc.h"
+// Circular Double Buffer
+#include "dma_stream.h"
+
+/**
+ ** Dual ADC Mode:
+ * - ADC1 (master) and ADC2 (slave) share the ADC1 trigger, DUALMOD is set in ADC1 CR1
+ * - ADC1 DR holds both regular results: ADC1 in [15:0], ADC2 in [31:16], the DMA (`DMA1_Channel1`)
+ * 	 moves one packed `uint32_t` per pair into the circular double buffer
+ * - On each half the packed words are unpacked into two `uint16_t` streams before the callback
+ * - Modes:
+ * 	 |--- `ADC_DUAL_REG_SIMULT`: both sequences convert at the same instant (same length, different channels,
+ * 	 	  a channel must not be converted by both ADCs at once)
+ * 	 |--- `ADC_DUAL_FAST_INTERLEAVED`: one channel, ADC2 starts 7 ADC clock cycles after ADC1,
+ * 	 	  with `cc` ON on both ADCs the combined rate doubles (~2 Msps at ADCCLK 14 MHz, `ADC_SAMPLE_1_5`)
+ * 	 |--- `ADC_DUAL_SLOW_INTERLEAVED`: one channel, ADC2 starts 14 ADC clock cycles after ADC1 (`cc` OFF)
+ * - Interleaved modes: the time ordered samples are `adc1[0]`, `adc2[0]`, `adc1[1]`, `adc2[1]`, ...
+ * - ADC2 must use `ADC_EXTSEL_SWSTART` (set by `ADC_config()` in Scan Mode): the master trigger starts it
+ */
+
+// Forward Declaration
+typedef struct adc_dual adc_dual_t;
+
+// "ADC_Dual_Callback_t" is now a type representing:
+// "Pointer to any function taking Dual ADC, ADC1 samples, ADC2 samples, Number of samples per ADC and returning void"
+typedef void (*ADC_Dual_Callback_t)(adc_dual_t* dual, const uint16_t* adc1, const uint16_t* adc2, uint16_t count);
+
+// Dual ADC (storage owned by the client while the conversions run)
+struct adc_dual {
+	// Master: `ADC1` configured with a `sequence` (trigger & `cc` of the pair)
+	adc_config_t* ADC1_CONFIG;
+	// Slave: `ADC2` configured with a `sequence` of the same length
+	adc_config_t* ADC2_CONFIG;
+	// Dual Mode
+	// - `ADC_DUAL_REG_SIMULT`
+	// - `ADC_DUAL_FAST_INTERLEAVED`
+	// - `ADC_DUAL_SLOW_INTERLEAVED`
+	uint8_t mode;
+	// Packed Double Buffer (ADC1 DR words)
+	uint32_t* buffer;
+	// Number of packed words in `buffer` (even, >= 2)
+	uint16_t count;
+	// Unpacked ADC1 samples (`count / 2` items)
+	uint16_t* adc1;
+	// Unpacked ADC2 samples (`count / 2` items)
+	uint16_t* adc2;
+	// Half Processing Callback (executed in interrupt context)
+	ADC_Dual_Callback_t callback;
+	// User Context
+	void* context;
+
+	// Internal State (managed by the driver)
+	// Circular DMA (`overrun`/`errors` statistics)
+	dma_stream_t dma;
+};
+
+/**
+ * @brief Splits packed ADC1 DR words into ADC1 & ADC2 samples
+ * @param[in] packed Packed results
+ * @param[out] adc1 ADC1 samples
+ * @param[out] adc2 ADC2 samples
+ * @param[in] count Number of packed words
+ */
+void ADC_Dual_Unpack(const uint32_t* packed, uint16_t* adc1, uint16_t* adc2, uint16_t count);
+
+/**
+ * @brief Enters the Dual Mode & starts the packed DMA stream
+ * @param[in] dual Pointer to the Dual ADC (must stay valid while running)
+ * @returns - `0x00`: Failure (Not ADC1/ADC2/No or mismatched sequences/Invalid mode/count/DMA Channel busy)
+ * @returns - `0x01`: Success
+ * @note - Both ADCs must have been configured with `ADC_config()` first
+ * @note - With `ADC_EXTSEL_SWSTART` the first conversion is started here, otherwise the ADC1 trigger starts it
+ */
+uint8_t ADC_Dual_Start(adc_dual_t* dual);
+
+/**
+ * @brief Stops the conversions, releases the DMA Channel & returns to Independent Mode
+ * @param[in] dual Pointer to the Dual ADC
+ */
+void ADC_Dual_Stop(adc_dual_t* dual);
+
+#endif /* __ADC_DUAL_H__ */
@@ -3,45 +3,257 @@
  *  Created on: 01/12/2024
  *  Author: Shrey Shah
  ***************************************************************************************/
-// TO DO: Use adc_sequence_t and develop a logic to read the data as per sequence using SQRx Registers
-
 // Header File
 #include "adc.h"
 
+// Registered JEOC Callbacks: [0] -> `ADC1`, [1] -> `ADC2`
+static ADC_Injected_Callback_t ADC_Injected_Handler[2] = {NULL};
+// Registered Analog Watchdog Callbacks: [0] -> `ADC1`, [1] -> `ADC2`
+static ADC_Watchdog_Callback_t ADC_Watchdog_Handler[2] = {NULL};
+
+/**
+ * @brief Connects the Temperature Sensor & VREFINT when an internal channel is selected
+ * @param[in] ADCx `ADC1`, `ADC2`, `ADC3`
+ * @param[in] channel `ADC_CHANNEL_0` - `ADC_CHANNEL_17`
+ * @note Only ADC1 reaches channels 16/17 (ADC2: internally connected to VSS)
+ */
+static void ADC_Internal_Channel_Check(ADC_REG_STRUCT* ADCx, uint8_t channel){
+	// Internal channel on ADC1, not connected yet (needs tSTART = 10 us before the first sample)
+	if((ADCx == ADC1) && (channel >= ADC_CHANNEL_TEMPSENSOR) && !(ADCx->CR2.REG & ADC_CR2_TSVREFE))
+		ADCx->CR2.REG |= ADC_CR2_TSVREFE;
+}
+
+/**
+ * @brief Programs the Regular Sequence (SQR1 - SQR3) & the Sample Times (SMPR1/SMPR2)
+ * @param[in] ADCx `ADC1`, `ADC2`, `ADC3`
+ * @param[in] sequence Regular Sequence
+ * @returns - `0x00`: Failure (Empty/Too long sequence/Invalid channel)
+ * @returns - `0x01`: Success
+ */
+uint8_t ADC_Set_Sequence(ADC_REG_STRUCT* ADCx, const adc_sequence_t* sequence){
+	// Local Variables
+	uint32_t SQR[3] = {0};
+	uint8_t rank = 0;
+	// Invalid Length
+	if((sequence == NULL) || (sequence->length == 0) || (sequence->length > ADC_MAX_SEQUENCE))
+		return 0x00;
+	// Number of conversions
+	SQR[0] = ((uint32_t)(sequence->length - 1) << ADC_SQR1_L_Pos);
+	// 5 bits per rank: SQR3 (ranks 1 - 6), SQR2 (ranks 7 - 12), SQR1 (ranks 13 - 16)
+	for(rank = 0; rank < sequence->length; rank++){
+		if(sequence->channel[rank] > ADC_CHANNEL_17)
+			return 0x00;
+		SQR[2 - (rank / 6)] |= ((uint32_t)sequence->channel[rank] << ((rank % 6) * 5));
+		ADC_Set_Sample_Time(ADCx, sequence->channel[rank], sequence->sample_time[rank]);
+		ADC_Internal_Channel_Check(ADCx, sequence->channel[rank]);
+	}
+	// Program the Sequence
+	ADCx->SQR1.REG = SQR[0];
+	ADCx->SQR2.REG = SQR[1];
+	ADCx->SQR3.REG = SQR[2];
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Programs the Injected Group (JSQR, JOFRx, JEXTSEL) & its JEOC Callback
+ * @param[in] ADCx `ADC1`, `ADC2`
+ * @param[in] injected Injected Group
+ * @returns - `0x00`: Failure (Not ADC1/ADC2/Empty/Too long group/Invalid channel)
+ * @returns - `0x01`: Success
+ * @note A group of more than one conversion sets SCAN (shared with the Regular Group)
+ */
+uint8_t ADC_Set_Injected(ADC_REG_STRUCT* ADCx, const adc_injected_t* injected){
+	// Local Variables
+	uint32_t JSQR = 0;
+	uint32_t reg = 0;
+	uint8_t rank = 0;
+	// Invalid Instance/Length
+	if((ADCx != ADC1) && (ADCx != ADC2))
+		return 0x00;
+	if((injected == NULL) || (injected->length == 0) || (injected->length > ADC_MAX_INJECTED))
+		return 0x00;
+	// Number of conversions
+	JSQR = ((uint32_t)(injected->length - 1) << ADC_JSQR_JL_Pos);
+	// 5 bits per rank: fewer than 4 conversions start at JSQ(5 - length) and end at JSQ4
+	for(rank = 0; rank < injected->length; rank++){
+		if(injected->channel[rank] > ADC_CHANNEL_17)
+			return 0x00;
+		JSQR |= ((uint32_t)injected->channel[rank] << ((ADC_MAX_INJECTED - injected->length + rank) * 5));
+		ADC_Set_Sample_Time(ADCx, injected->channel[rank], injected->sample_time[rank]);
+		ADC_Internal_Channel_Check(ADCx, injected->channel[rank]);
+		// Offset of the rank (JOFR1 - JOFR4 are consecutive)
+		(&ADCx->JOFR1.REG)[rank] = (injected->offset[rank] & MAX_ADC_VALUE);
+	}
+	// Program the Group
+	ADCx->JSQR.REG = JSQR;
+	// Trigger Source & External Trigger Enable
+	reg = ADCx->CR2.REG & ~ADC_CR2_JEXTSEL_Msk;
+	reg |= ((uint32_t)(injected->trigger & 0x07) << ADC_CR2_JEXTSEL_Pos) | ADC_CR2_JEXTTRIG;
+	ADC_Write_CR2(ADCx, reg);
+	// Every rank of the group per trigger
+	if(injected->length > 1)
+		ADCx->CR1.REG |= ADC_CR1_SCAN;
+	// JEOC Interrupt
+	ADC_Injected_Handler[(ADCx == ADC2)] = injected->callback;
+	if(injected->callback != NULL){
+		ADCx->CR1.REG |= ADC_CR1_JEOCIE;
+		NVIC_IRQ_Enable(ADC1_2_IRQn);
+	}
+	else
+		ADCx->CR1.REG &= ~ADC_CR1_JEOCIE;
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Programs the Analog Watchdog (HTR/LTR, guarded groups & channel) & its Callback
+ * @param[in] ADCx `ADC1`, `ADC2`
+ * @param[in] watchdog Analog Watchdog
+ * @returns - `0x00`: Failure (Not ADC1/ADC2/Invalid thresholds/channel)
+ * @returns - `0x01`: Success
+ * @note The comparison runs in hardware on every conversion: no CPU is used until a result leaves the window
+ */
+uint8_t ADC_Set_Watchdog(ADC_REG_STRUCT* ADCx, const adc_watchdog_t* watchdog){
+	// Local Variable
+	uint32_t reg = 0;
+	// Invalid Instance/Thresholds/Channel
+	if(((ADCx != ADC1) && (ADCx != ADC2)) || (watchdog == NULL))
+		return 0x00;
+	if((watchdog->high > MAX_ADC_VALUE) || (watchdog->low > watchdog->high))
+		return 0x00;
+	if((watchdog->channel > ADC_CHANNEL_17) && (watchdog->channel != ADC_AWD_ALL_CHANNELS))
+		return 0x00;
+	// Disable while the window moves
+	reg = ADCx->CR1.REG & ~(ADC_CR1_AWDEN | ADC_CR1_JAWDEN | ADC_CR1_AWDSGL | ADC_CR1_AWDCH_Msk | ADC_CR1_AWDIE);
+	ADCx->CR1.REG = reg;
+	// Window
+	ADC_Watchdog_Set_Thresholds(ADCx, watchdog->high, watchdog->low);
+	// Single Channel / every channel of the guarded groups
+	if(watchdog->channel != ADC_AWD_ALL_CHANNELS)
+		reg |= (ADC_CR1_AWDSGL | ((uint32_t)watchdog->channel << ADC_CR1_AWDCH_Pos));
+	// Guarded Groups
+	if(watchdog->groups & ADC_AWD_GROUP_REGULAR)
+		reg |= ADC_CR1_AWDEN;
+	if(watchdog->groups & ADC_AWD_GROUP_INJECTED)
+		reg |= ADC_CR1_JAWDEN;
+	// Analog Watchdog Interrupt
+	ADC_Watchdog_Handler[(ADCx == ADC2)] = watchdog->callback;
+	ADCx->SR.REG = ~(uint32_t)ADC_SR_AWD;
+	if(watchdog->callback != NULL){
+		reg |= ADC_CR1_AWDIE;
+		NVIC_IRQ_Enable(ADC1_2_IRQn);
+	}
+	ADCx->CR1.REG = reg;
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Converts a Temperature Sensor result to temperature
+ * @param[in] temp_raw Temperature Sensor (`ADC_CHANNEL_TEMPSENSOR`) result
+ * @param[in] vrefint_raw VREFINT (`ADC_CHANNEL_VREFINT`) result from the same supply
+ * @returns Temperature (in 0.01 degC)
+ * @note Typical V25/Avg Slope: the absolute error is a few degC unless calibrated, the variation is accurate
+ */
+int32_t ADC_Get_Temperature(uint16_t temp_raw, uint16_t vrefint_raw){
+	// Local Variable
+	int32_t vsense = 0;
+	// No reference reading
+	if(vrefint_raw == 0)
+		return ADC_TEMP_REF_centi_C;
+	// Sensor voltage in 10 uV (4095 * 120000 fits in 32 bits)
+	vsense = (int32_t)((((uint32_t)temp_raw * (ADC_VREFINT_mV * 100)) + (vrefint_raw >> 1)) / vrefint_raw);
+	// T = (V25 - Vsense) / Avg_Slope + 25 (the sensor voltage falls with temperature)
+	return ADC_TEMP_REF_centi_C + (((ADC_TEMP_V25_10uV - vsense) * 100) / ADC_TEMP_SLOPE_10uV);
+}
+
+/**
+ * @brief Converts a scan to millivolts with the VREFINT rank of the same scan
+ * @param[in] sequence Regular Sequence of the scan (must contain `ADC_CHANNEL_VREFINT`)
+ * @param[in] data Scan results, one per rank
+ * @param[out] mV Voltages, one per rank (may alias `data`)
+ * @returns - `0x00`: Failure (No VREFINT rank/VREFINT reads 0)
+ * @returns - `0x01`: Success
+ */
+uint8_t ADC_Scan_To_mV(const adc_sequence_t* sequence, const uint16_t* data, uint16_t* mV){
+	// Local Variables
+	uint16_t vrefint_raw = 0;
+	uint8_t rank = 0;
+	// Find the reference of this scan
+	for(rank = 0; rank < sequence->length; rank++){
+		if(sequence->channel[rank] == ADC_CHANNEL_VREFINT){
+			vrefint_raw = data[rank];
+			break;
+		}
+	}
+	if(vrefint_raw == 0)
+		return 0x00;
+	// Same supply for every rank: one ratio corrects them all
+	for(rank = 0; rank < sequence->length; rank++)
+		mV[rank] = ADC_Raw_To_mV(data[rank], vrefint_raw);
+	// Success
+	return 0x01;
+}
+
 /**
  * @brief Configures the ADC based upon ADC Configuration Structure
  * @param[in] ADC_CONFIGx ADC Configuration Structure
+ * @note - Single channel (`sequence == NULL`): conversions start immediately
+ * @note - Scan Mode (`sequence != NULL`): the ADC is powered & calibrated, conversions start on `ADC_Software_Trigger()`
+ * @note - Injected Group (`injected != NULL`): converted on its own trigger, interrupting the Regular Group
+ * @note - Analog Watchdog (`watchdog != NULL`): guards the results in hardware
+ * @note - `ADC_CHANNEL_TEMPSENSOR`/`ADC_CHANNEL_VREFINT` (ADC1) enable TSVREFE, use `ADC_SAMPLE_239_5` (>= 17.1 us)
  */
 void ADC_config(adc_config_t* ADC_CONFIGx){
 	// Enable Clock for ADC
 	ADC_clk_enable(ADC_CONFIGx->ADCx);
 	// Disable the ADC if already ON
 	ADC_disable(ADC_CONFIGx->ADCx);
-	// Configure GPIO
-	GPIO_Config(ADC_CONFIGx->GPIOx_CONFIG);
+	// Configure GPIO (Scan Mode: the other inputs are configured by the user)
+	if(ADC_CONFIGx->GPIOx_CONFIG != NULL)
+		GPIO_Config(ADC_CONFIGx->GPIOx_CONFIG);
 
 	// Reset Registers
 	ADC_CONFIGx->ADCx->SR.REG = (uint32_t) 0x00000000;
 	ADC_CONFIGx->ADCx->CR1.REG = (uint32_t) 0x00000000;
 	ADC_CONFIGx->ADCx->CR2.REG = (uint32_t) 0x00000000;
+	ADC_CONFIGx->ADCx->SMPR1.REG = (uint32_t) 0x000000;
 	ADC_CONFIGx->ADCx->SMPR2.REG = (uint32_t) 0x000000;
 	ADC_CONFIGx->ADCx->SQR1.REG = (uint32_t) 0x000000;
 	ADC_CONFIGx->ADCx->SQR2.REG = (uint32_t) 0x000000;
 	ADC_CONFIGx->ADCx->SQR3.REG = (uint32_t) 0x000000;
+	ADC_CONFIGx->ADCx->JSQR.REG = (uint32_t) 0x000000;
 
-	// Sampling Time
-	// ADC_CONFIGx->ADCx->SMPR2.REG |= ((ADC_SAMPLE_TIME(ADC_CONFIGx->sample_time) & 0x07) << (ADC_SAMPLE_CHANNEL(ADC_CONFIGx->sample_time) * 3));
-	ADC_CONFIGx->ADCx->SMPR2.REG |= ((ADC_CONFIGx->sample_time & 0x07) << (ADC_CONFIGx->channel * 3));
-	// Number of Channel for Conversion
-	ADC_CONFIGx->ADCx->SQR1.REG |= ((ADC_CONFIGx->num_channels - 1) << 20);
-	// Configure Channel Sequence
-	if(ADC_CONFIGx->num_channels == 1){
-		ADC_CONFIGx->ADCx->SQR3.REG |= ADC_CONFIGx->channel;
+	// Scan Mode: every channel of the sequence is converted per trigger
+	if(ADC_CONFIGx->sequence != NULL){
+		ADC_Set_Sequence(ADC_CONFIGx->ADCx, ADC_CONFIGx->sequence);
+		ADC_CONFIGx->ADCx->CR1.REG |= ADC_CR1_SCAN;
+		// Software Trigger
+		ADC_Set_External_Trigger(ADC_CONFIGx->ADCx, ADC_EXTSEL_SWSTART);
+	}
+	// Single Channel
+	else{
+		// Sampling Time
+		ADC_Set_Sample_Time(ADC_CONFIGx->ADCx, ADC_CONFIGx->channel, ADC_CONFIGx->sample_time);
+		ADC_Internal_Channel_Check(ADC_CONFIGx->ADCx, ADC_CONFIGx->channel);
+		// Number of Channel for Conversion
+		ADC_CONFIGx->ADCx->SQR1.REG |= ((ADC_CONFIGx->num_channels - 1) << 20);
+		// Configure Channel Sequence
+		if(ADC_CONFIGx->num_channels == 1){
+			ADC_CONFIGx->ADCx->SQR3.REG |= ADC_CONFIGx->channel;
+		}
 	}
 	// ADC Data Alignment
 	ADC_CONFIGx->ADCx->CR2.REG |= ((ADC_CONFIGx->data_alignment & 0x01) << 11);
 	// Continuous Conversion
 	ADC_CONFIGx->ADCx->CR2.REG |= ((ADC_CONFIGx->cc & 0x01) << 1);
+	// Injected Group (after the Regular Sequence: Sample Times of shared channels follow the group)
+	if(ADC_CONFIGx->injected != NULL)
+		ADC_Set_Injected(ADC_CONFIGx->ADCx, ADC_CONFIGx->injected);
+	// Analog Watchdog
+	if(ADC_CONFIGx->watchdog != NULL)
+		ADC_Set_Watchdog(ADC_CONFIGx->ADCx, ADC_CONFIGx->watchdog);
 	// IRQ Configuration
 	if(ADC_CONFIGx->enable_IRQ == (ADCx_IRQ_ENABLE)){
 		// Enable the IQR Bit
@@ -49,8 +261,12 @@ void ADC_config(adc_config_t* ADC_CONFIGx){
 		// Enable NVIC IRQ
 		NVIC_IRQ_Enable(ADC_get_IRQn(ADC_CONFIGx));
 	}
+	// Scan Mode: wait for the trigger
+	if(ADC_CONFIGx->sequence != NULL)
+		ADC_power_on(ADC_CONFIGx->ADCx);
 	// Starts the ADC
-	ADC_start(ADC_CONFIGx->ADCx);
+	else
+		ADC_start(ADC_CONFIGx->ADCx);
 }
 
 /**
@@ -72,3 +288,46 @@ uint16_t ADC_get_data(adc_config_t* ADC_CONFIGx){
 	// Return the result
 	return result; 
 }
+
+/**
+ * @brief Services the Injected Group & the Analog Watchdog of one ADC
+ * @param[in] ADCx `ADC1`, `ADC2`
+ * @param[in] index Registered Callbacks: [0] -> `ADC1`, [1] -> `ADC2`
+ */
+static void ADC_IRQ_Handler(ADC_REG_STRUCT* ADCx, uint8_t index){
+	// Local Variables
+	int16_t data[ADC_MAX_INJECTED] = {0};
+	uint8_t count = 0;
+	uint8_t rank = 0;
+	// Injected Group converted
+	if((ADCx->SR.REG & ADC_SR_JEOC) && (ADCx->CR1.REG & ADC_CR1_JEOCIE)){
+		// Clear JEOC/JSTRT (rc_w0: writing 1 leaves the other flags untouched)
+		ADCx->SR.REG = ~(uint32_t)(ADC_SR_JEOC | ADC_SR_JSTRT);
+		// Results in conversion order
+		count = (uint8_t)(((ADCx->JSQR.REG & ADC_JSQR_JL_Msk) >> ADC_JSQR_JL_Pos) + 1);
+		for(rank = 0; rank < count; rank++)
+			data[rank] = ADC_Get_Injected_Data(ADCx, rank);
+		// Notify
+		if(ADC_Injected_Handler[index] != NULL)
+			ADC_Injected_Handler[index](ADCx, data, count);
+	}
+	// Result outside the window
+	if((ADCx->SR.REG & ADC_SR_AWD) && (ADCx->CR1.REG & ADC_CR1_AWDIE)){
+		// One shot: the flag is set again by every conversion outside the window
+		ADCx->CR1.REG &= ~ADC_CR1_AWDIE;
+		ADCx->SR.REG = ~(uint32_t)ADC_SR_AWD;
+		// Notify
+		if(ADC_Watchdog_Handler[index] != NULL)
+			ADC_Watchdog_Handler[index](ADCx);
+	}
+}
+
+/**
+ * @brief ADC1/ADC2 IRQ Handler
+ * @note Services the Injected Group, an EOC Interrupt (`enable_IRQ`) is left to an application handler
+ */
+__attribute__((weak)) void ADC1_2_IRQHandler(void){
+	// Shared vector
+	ADC_IRQ_Handler(ADC1, 0);
+	ADC_IRQ_Handler(ADC2, 1);
+}
@@ -0,0 +1,253 @@
+// Header
+#include "adc_dma.h"
+
+// ADC1 Scan State
+typedef struct {
+	// Results
+	uint16_t* buffer;
+	// Number of results per scan
+	uint8_t count;
+	// Scan Callback
+	ADC_Scan_Callback_t callback;
+} adc_scan_t;
+
+// ADC1 Scan
+static adc_scan_t adc_scan = {0};
+
+/**
+ * @brief DMA Transfer Complete Callback: one scan converted
+ * @param[in] DMA_channelX DMA Channel
+ * @param[in] context ADC Instance
+ */
+static void ADC_Scan_TC_Callback(DMA_CHANNEL_REG_STRUCT* DMA_channelX, void* context){
+	// Whole Sequence
+	if(adc_scan.callback != NULL)
+		adc_scan.callback((ADC_REG_STRUCT *)context, ADCx_SCAN_STATUS_DONE, adc_scan.buffer, adc_scan.count);
+}
+
+/**
+ * @brief DMA Transfer Error Callback: hardware disabled the channel
+ * @param[in] DMA_channelX DMA Channel
+ * @param[in] context ADC Instance
+ */
+static void ADC_Scan_TE_Callback(DMA_CHANNEL_REG_STRUCT* DMA_channelX, void* context){
+	// Local Variable
+	ADC_REG_STRUCT* ADCx = (ADC_REG_STRUCT *)context;
+	// Stop requesting
+	ADC_Write_CR2(ADCx, ADCx->CR2.REG & ~(ADC_CR2_DMA | ADC_CR2_CONT));
+	DMA_CH_Release(DMA_channelX);
+	// Notify
+	if(adc_scan.callback != NULL)
+		adc_scan.callback(ADCx, ADCx_SCAN_STATUS_ERROR, adc_scan.buffer, 0);
+}
+
+/**
+ * @brief Arms the DMA for the Regular Sequence & starts the first scan
+ * @param[in] ADC_CONFIGx ADC Configuration Structure (configured with a `sequence`)
+ * @param[out] buffer Results, one per rank (`sequence->length` items, must stay valid while armed)
+ * @param[in] callback Scan Callback (executed in interrupt context, may be NULL)
+ * @returns - `0x00`: Failure (Not ADC1/No sequence/DMA Channel owned by another request)
+ * @returns - `0x01`: Success
+ * @note Continuous Conversion (`cc`) repeats the scan back to back, otherwise call `ADC_Software_Trigger()` per scan
+ */
+uint8_t ADC_Scan_DMA_Start(adc_config_t* ADC_CONFIGx, uint16_t* buffer, ADC_Scan_Callback_t callback){
+	// Local Variables
+	ADC_REG_STRUCT* ADCx = ADC_CONFIGx->ADCx;
+	dma_config_t dma_config = {0};
+	// Only ADC1 has a DMA Request
+	if((ADCx != ADC1) || (ADC_CONFIGx->sequence == NULL) || (buffer == NULL))
+		return 0x00;
+	// Claim the Channel
+	if(!DMA_CH_Allocate(DMA_ADC1, DMAx_REQ_ADC1))
+		return 0x00;
+
+	// Scan State
+	adc_scan.buffer = buffer;
+	adc_scan.count = ADC_CONFIGx->sequence->length;
+	adc_scan.callback = callback;
+	// Channel Configuration: ADC1->DR -> buffer, circular over one scan
+	dma_config.DMA_Channel = DMA_ADC1;
+	dma_config.channel.direction = DMAx_DIR_READ_PER;
+	dma_config.channel.mem2mem = DMAx_MEM2MEM_DISABLE;
+	dma_config.channel.circular_mode = DMAx_CIRC_ENABLE;
+	dma_config.channel.priority = DMAx_PRIORITY_HIGH;
+	dma_config.data.srcDataSize = DMAx_DATA_SIZE_BIT_16;
+	dma_config.data.dstDataSize = DMAx_DATA_SIZE_BIT_16;
+	dma_config.data.srcInc = DMAx_INC_DISABLE;
+	dma_config.data.dstInc = DMAx_INC_ENABLE;
+	dma_config.interrupt.TCIE = DMAx_IRQ_ENABLE;
+	dma_config.interrupt.HTIE = DMAx_IRQ_DISABLE;
+	dma_config.interrupt.TEIE = DMAx_IRQ_ENABLE;
+	DMA_Config(&dma_config);
+	DMA_CH_clear_flags(DMA_ADC1, DMAx_FLAG_ALL);
+	DMA_CH_Register_Callback(DMA_ADC1, ADC_Scan_TC_Callback, NULL, ADC_Scan_TE_Callback, ADCx);
+	DMA_Transfer_Config(DMA_ADC1, (void *)&ADCx->DR.REG, buffer, adc_scan.count);
+	DMA_CH_enable(DMA_ADC1);
+
+	// ADC DMA Request
+	ADCx->CR2.REG |= ADC_CR2_DMA;
+	// First scan (software triggered sequence)
+	if(((ADCx->CR2.REG & ADC_CR2_EXTSEL_Msk) >> ADC_CR2_EXTSEL_Pos) == ADC_EXTSEL_SWSTART)
+		ADC_Software_Trigger(ADCx);
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Stops the scans and releases the DMA Channel
+ * @param[in] ADC_CONFIGx ADC Configuration Structure
+ */
+void ADC_Scan_DMA_Stop(adc_config_t* ADC_CONFIGx){
+	// Stop Continuous Conversion & DMA Requests
+	ADC_Write_CR2(ADC_CONFIGx->ADCx, ADC_CONFIGx->ADCx->CR2.REG & ~(ADC_CR2_DMA | ADC_CR2_CONT));
+	// Free the Channel (only if owned by the ADC)
+	if(DMA_CH_Get_Owner(DMA_ADC1) == DMAx_REQ_ADC1)
+		DMA_CH_Release(DMA_ADC1);
+	// Clear State
+	adc_scan.callback = NULL;
+}
+
+/**
+ * @brief DMA Stream Half Callback: forwards the finished half (whole scans)
+ * @param[in] dma DMA Stream
+ * @param[in] half Pointer to the finished half
+ * @param[in] count Number of results in the half
+ */
+static void ADC_Stream_Half_Callback(dma_stream_t* dma, void* half, uint16_t count){
+	// Local Variable
+	adc_stream_t* stream = (adc_stream_t *)dma->context;
+	// Notify
+	if(stream->callback != NULL)
+		stream->callback(stream, (const uint16_t *)half, count);
+}
+
+/**
+ * @brief Programs the Trigger Timer for one trigger per scan
+ * @param[in] stream Pointer to the ADC Stream
+ * @returns - `0x00`: Failure (Rate above Timer Clock / `ADC_STREAM_MIN_TICKS`)
+ * @returns - `0x01`: Success
+ * @note The Timer is left disabled
+ */
+static uint8_t ADC_Stream_Timer_Config(adc_stream_t* stream){
+	// Local Variables
+	timer_config_t TIMx_CONFIG = {0};
+	uint32_t timer_freq_Hz = TIM_Get_Frequency(stream->TIM);
+	uint32_t ticks = 0;
+	uint32_t prescaler = 0;
+	uint32_t auto_reload = 0;
+	// Timer ticks per scan
+	ticks = timer_freq_Hz / stream->rate_Hz;
+	if(ticks < ADC_STREAM_MIN_TICKS)
+		return 0x00;
+	// Smallest Prescaler keeping ARR within 16 bits (finest rate resolution)
+	prescaler = (ticks - 1) >> 16;
+	auto_reload = (ticks / (prescaler + 1)) - 1;
+
+	// Time Base
+	TIMx_CONFIG.TIM = stream->TIM;
+	TIMx_CONFIG.auto_reload = (uint16_t)auto_reload;
+	TIMx_CONFIG.prescaler = prescaler;
+	TIMx_CONFIG.count = TIMx_DEFAULT_CNT;
+	TIMx_CONFIG.cms_mode = TIMx_CMS_EDGE;
+	TIMx_CONFIG.direction = TIMx_DIR_COUNT_UP;
+	TIMx_CONFIG.arpe = TIMx_ARPE_ENABLE;
+	TIMx_CONFIG.one_pulse = TIMx_OPM_DISABLE;
+	TIM_Config(&TIMx_CONFIG);
+	// TIM3: TRGO on every Update Event
+	if(stream->TIM == TIM3){
+		stream->TIM->CR2.REG &= ~TIM_CR2_MMS_Msk;
+		stream->TIM->CR2.REG |= ((uint32_t)TIMx_MMS_UPDATE << TIM_CR2_MMS_Pos);
+	}
+	// TIM2: OC2REF rises once per period (CC2 event)
+	else if(stream->TIM == TIM2){
+		stream->TIM->CCMR1.REG &= ~(TIM_CCMR1_CC2S_Msk | TIM_CCMR1_OC2M_Msk);
+		stream->TIM->CCMR1.REG |= ((uint32_t)PWM_MODE_NORMAL << TIM_CCMR1_OC2M_Pos);
+		stream->TIM->CCR2.CC2_OUT = (auto_reload + 1) >> 1;
+		TIM_Channel_Enable(stream->TIM, TIMx_CHANNEL_2);
+	}
+	// TIM4: OC4REF rises once per period (CC4 event)
+	else{
+		stream->TIM->CCMR2.REG &= ~(TIM_CCMR2_CC4S_Msk | TIM_CCMR2_OC4M_Msk);
+		stream->TIM->CCMR2.REG |= ((uint32_t)PWM_MODE_NORMAL << TIM_CCMR2_OC4M_Pos);
+		stream->TIM->CCR4.CC4_OUT = (auto_reload + 1) >> 1;
+		TIM_Channel_Enable(stream->TIM, TIMx_CHANNEL_4);
+	}
+	// Achieved Rate
+	stream->actual_rate_Hz = timer_freq_Hz / ((prescaler + 1) * (auto_reload + 1));
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Starts a Timer Triggered Stream
+ * @param[in] stream Pointer to the ADC Stream (must stay valid while running)
+ * @returns - `0x00`: Failure (Not ADC1/No sequence/Invalid count/Timer/Rate above Timer Clock/DMA Channel busy)
+ * @returns - `0x01`: Success
+ * @note The Trigger Timer is reconfigured (PSC/ARR/CR2/CCMR), it must not be shared with another function
+ */
+uint8_t ADC_Stream_Start(adc_stream_t* stream){
+	// Local Variables
+	ADC_REG_STRUCT* ADCx = NULL;
+	uint8_t extsel = ADC_EXTSEL_SWSTART;
+	uint8_t length = 0;
+	// Invalid Arguments
+	if((stream == NULL) || (stream->ADC_CONFIGx == NULL) || (stream->buffer == NULL) || (stream->rate_Hz == 0))
+		return 0x00;
+	ADCx = stream->ADC_CONFIGx->ADCx;
+	// Only ADC1 has a DMA Request
+	if((ADCx != ADC1) || (stream->ADC_CONFIGx->sequence == NULL))
+		return 0x00;
+	// Each half holds whole scans
+	length = stream->ADC_CONFIGx->sequence->length;
+	if((stream->count == 0) || (stream->count % (2 * length)))
+		return 0x00;
+	// Trigger Source
+	if(stream->TIM == TIM2)
+		extsel = ADC_EXTSEL_TIM2_CC2;
+	else if(stream->TIM == TIM3)
+		extsel = ADC_EXTSEL_TIM3_TRGO;
+	else if(stream->TIM == TIM4)
+		extsel = ADC_EXTSEL_TIM4_CC4;
+	else
+		return 0x00;
+
+	// Time Base (Timer stays disabled until everything is armed)
+	if(!ADC_Stream_Timer_Config(stream))
+		return 0x00;
+	// One scan per trigger
+	ADC_Write_CR2(ADCx, ADCx->CR2.REG & ~(ADC_CR2_DMA | ADC_CR2_CONT));
+	ADC_Set_External_Trigger(ADCx, extsel);
+	// Circular Double Buffer: ADC1->DR -> buffer
+	stream->dma.DMA_Channel = DMA_ADC1;
+	stream->dma.request = DMAx_REQ_ADC1;
+	stream->dma.direction = DMAx_DIR_READ_PER;
+	stream->dma.priority = DMAx_PRIORITY_VERY_HIGH;
+	stream->dma.perDataSize = DMAx_DATA_SIZE_BIT_16;
+	stream->dma.memDataSize = DMAx_DATA_SIZE_BIT_16;
+	stream->dma.peripheral = (volatile void *)&ADCx->DR.REG;
+	stream->dma.buffer = stream->buffer;
+	stream->dma.count = stream->count;
+	stream->dma.callback = ADC_Stream_Half_Callback;
+	stream->dma.context = stream;
+	if(!DMA_Stream_Start(&stream->dma))
+		return 0x00;
+	// ADC DMA Request
+	ADCx->CR2.REG |= ADC_CR2_DMA;
+	// Start triggering
+	TIM_Enable(stream->TIM);
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Stops a Timer Triggered Stream (Timer, ADC DMA Request & DMA Channel)
+ * @param[in] stream Pointer to the ADC Stream
+ */
+void ADC_Stream_Stop(adc_stream_t* stream){
+	// No more triggers
+	TIM_Disable(stream->TIM);
+	// Stop DMA Requests
+	ADC_Write_CR2(stream->ADC_CONFIGx->ADCx, stream->ADC_CONFIGx->ADCx->CR2.REG & ~ADC_CR2_DMA);
+	// Release the Channel
+	DMA_Stream_Stop(&stream->dma);
+}
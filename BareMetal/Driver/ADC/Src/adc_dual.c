@@ -0,0 +1,130 @@
+// Header
+#include "adc_dual.h"
+
+/**
+ * @brief Splits packed ADC1 DR words into ADC1 & ADC2 samples
+ * @param[in] packed Packed results
+ * @param[out] adc1 ADC1 samples
+ * @param[out] adc2 ADC2 samples
+ * @param[in] count Number of packed words
+ */
+void ADC_Dual_Unpack(const uint32_t* packed, uint16_t* adc1, uint16_t* adc2, uint16_t count){
+	// One pair per word
+	while(count--){
+		*adc1++ = ADC_DUAL_ADC1_DATA(*packed);
+		*adc2++ = ADC_DUAL_ADC2_DATA(*packed);
+		packed++;
+	}
+}
+
+/**
+ * @brief DMA Stream Half Callback: unpacks the finished half into the two sample streams
+ * @param[in] dma DMA Stream
+ * @param[in] half Pointer to the finished half
+ * @param[in] count Number of packed words in the half
+ */
+static void ADC_Dual_Half_Callback(dma_stream_t* dma, void* half, uint16_t count){
+	// Local Variable
+	adc_dual_t* dual = (adc_dual_t *)dma->context;
+	// Split the pairs
+	ADC_Dual_Unpack((const uint32_t *)half, dual->adc1, dual->adc2, count);
+	// Notify
+	if(dual->callback != NULL)
+		dual->callback(dual, dual->adc1, dual->adc2, count);
+}
+
+/**
+ * @brief Validates the ADC1/ADC2 sequences against the Dual Mode
+ * @param[in] dual Pointer to the Dual ADC
+ * @returns - `0x00`: Failure
+ * @returns - `0x01`: Success
+ */
+static uint8_t ADC_Dual_Check_Sequences(adc_dual_t* dual){
+	// Local Variables
+	const adc_sequence_t* seq1 = dual->ADC1_CONFIG->sequence;
+	const adc_sequence_t* seq2 = dual->ADC2_CONFIG->sequence;
+	uint8_t rank = 0;
+	// One pair per rank
+	if((seq1 == NULL) || (seq2 == NULL) || (seq1->length != seq2->length))
+		return 0x00;
+	// Interleaved: both ADCs sample the same (single) channel
+	if(dual->mode != ADC_DUAL_REG_SIMULT)
+		return ((seq1->length == 1) && (seq1->channel[0] == seq2->channel[0]));
+	// Simultaneous: a channel cannot be sampled by both ADCs at the same instant
+	for(rank = 0; rank < seq1->length; rank++){
+		if(seq1->channel[rank] == seq2->channel[rank])
+			return 0x00;
+	}
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Enters the Dual Mode & starts the packed DMA stream
+ * @param[in] dual Pointer to the Dual ADC (must stay valid while running)
+ * @returns - `0x00`: Failure (Not ADC1/ADC2/No or mismatched sequences/Invalid mode/count/DMA Channel busy)
+ * @returns - `0x01`: Success
+ * @note - Both ADCs must have been configured with `ADC_config()` first
+ * @note - With `ADC_EXTSEL_SWSTART` the first conversion is started here, otherwise the ADC1 trigger starts it
+ */
+uint8_t ADC_Dual_Start(adc_dual_t* dual){
+	// Invalid Arguments
+	if((dual == NULL) || (dual->ADC1_CONFIG == NULL) || (dual->ADC2_CONFIG == NULL))
+		return 0x00;
+	if((dual->ADC1_CONFIG->ADCx != ADC1) || (dual->ADC2_CONFIG->ADCx != ADC2))
+		return 0x00;
+	if((dual->buffer == NULL) || (dual->adc1 == NULL) || (dual->adc2 == NULL))
+		return 0x00;
+	// Invalid Mode
+	if((dual->mode != ADC_DUAL_REG_SIMULT) && (dual->mode != ADC_DUAL_FAST_INTERLEAVED) && (dual->mode != ADC_DUAL_SLOW_INTERLEAVED))
+		return 0x00;
+	if(!ADC_Dual_Check_Sequences(dual))
+		return 0x00;
+
+	// Circular Double Buffer: ADC1->DR (both results) -> buffer
+	dual->dma.DMA_Channel = DMA_ADC1;
+	dual->dma.request = DMAx_REQ_ADC1;
+	dual->dma.direction = DMAx_DIR_READ_PER;
+	dual->dma.priority = DMAx_PRIORITY_VERY_HIGH;
+	dual->dma.perDataSize = DMAx_DATA_SIZE_BIT_32;
+	dual->dma.memDataSize = DMAx_DATA_SIZE_BIT_32;
+	dual->dma.peripheral = (volatile void *)&ADC1->DR.REG;
+	dual->dma.buffer = dual->buffer;
+	dual->dma.count = dual->count;
+	dual->dma.callback = ADC_Dual_Half_Callback;
+	dual->dma.context = dual;
+	if(!DMA_Stream_Start(&dual->dma))
+		return 0x00;
+
+	// DUALMOD is changed with both ADCs powered down
+	ADC_disable(ADC1);
+	ADC_disable(ADC2);
+	ADC1->CR1.REG &= ~ADC_CR1_DUALMOD_Msk;
+	ADC1->CR1.REG |= ((uint32_t)dual->mode << ADC_CR1_DUALMOD_Pos);
+	// Slave follows the master trigger
+	ADC_Set_External_Trigger(ADC2, ADC_EXTSEL_SWSTART);
+	// Power up & recalibrate (slave first, the master trigger must find it ready)
+	ADC_power_on(ADC2);
+	ADC_power_on(ADC1);
+	// ADC1 DMA Request after the calibration (ADC2 has none, its result is in ADC1 DR)
+	ADC1->CR2.REG |= ADC_CR2_DMA;
+	// First conversion (software triggered master)
+	if(((ADC1->CR2.REG & ADC_CR2_EXTSEL_Msk) >> ADC_CR2_EXTSEL_Pos) == ADC_EXTSEL_SWSTART)
+		ADC_Software_Trigger(ADC1);
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Stops the conversions, releases the DMA Channel & returns to Independent Mode
+ * @param[in] dual Pointer to the Dual ADC
+ */
+void ADC_Dual_Stop(adc_dual_t* dual){
+	// Stop Continuous Conversion & DMA Requests
+	ADC_Write_CR2(ADC1, ADC1->CR2.REG & ~(ADC_CR2_DMA | ADC_CR2_CONT));
+	ADC_Write_CR2(ADC2, ADC2->CR2.REG & ~ADC_CR2_CONT);
+	// Independent Mode
+	ADC1->CR1.REG &= ~ADC_CR1_DUALMOD_Msk;
+	// Release the Channel
+	DMA_Stream_Stop(&dual->dma);
+}
@@ -69,6 +69,10 @@ typedef struct {
 	uint8_t TEIE: 1;
 } dma_channel_intr_t;
 
+// "DMA_Callback_t" is now a type representing:
+// "Pointer to any function taking DMA Channel, User Context and returning void"
+typedef void (*DMA_Callback_t)(DMA_CHANNEL_REG_STRUCT* DMA_channelX, void* context);
+
 // DMA Configuration Structure
 typedef struct {
 	// DMA Channel
@@ -213,6 +217,49 @@ __STATIC_INLINE__ uint8_t DMA_CH_get_IRQn(DMA_CHANNEL_REG_STRUCT* DMA_channelX){
 	}
 }
 
+/**
+ * @brief Get the DMA Channel Number
+ * @param[in] DMA_channelX DMA Channel
+ * @returns The DMA Channel Number (1 - 7)
+ * @note Channel registers are spaced 0x14 apart starting at offset 0x08
+ */
+__STATIC_INLINE__ uint8_t DMA_CH_get_number(DMA_CHANNEL_REG_STRUCT* DMA_channelX){
+	// Offset from the DMA Base Address
+	uint32_t offset = ((uint32_t)DMA_channelX & 0x3FF);
+	// Return the Channel Number
+	return (uint8_t)(((offset - 0x08) / 0x14) + 1);
+}
+
+/**
+ * @brief Get the DMA Controller of the DMA Channel
+ * @param[in] DMA_channelX DMA Channel
+ * @returns `DMA1`, `DMA2`
+ */
+__STATIC_INLINE__ DMA_REG_STRUCT* DMA_CH_get_DMA(DMA_CHANNEL_REG_STRUCT* DMA_channelX){
+	// Controller Base Address is 1kB aligned
+	return (DMA_REG_STRUCT *)((uint32_t)DMA_channelX & ~((uint32_t)0x3FF));
+}
+
+/**
+ * @brief Retrieves the Interrupt Flags of the DMA Channel
+ * @param[in] DMA_channelX DMA Channel
+ * @returns Any logical combination of `DMAx_FLAG_GIF`, `DMAx_FLAG_TCIF`, `DMAx_FLAG_HTIF`, `DMAx_FLAG_TEIF`
+ */
+__STATIC_INLINE__ uint8_t DMA_CH_get_flags(DMA_CHANNEL_REG_STRUCT* DMA_channelX){
+	// Each channel owns a nibble in DMA_ISR
+	return (uint8_t)((DMA_CH_get_DMA(DMA_channelX)->ISR.REG >> ((DMA_CH_get_number(DMA_channelX) - 1) << 2)) & DMAx_FLAG_ALL);
+}
+
+/**
+ * @brief Clears the Interrupt Flags of the DMA Channel
+ * @param[in] DMA_channelX DMA Channel
+ * @param[in] flags Any logical combination of `DMAx_FLAG_GIF`, `DMAx_FLAG_TCIF`, `DMAx_FLAG_HTIF`, `DMAx_FLAG_TEIF`
+ */
+__STATIC_INLINE__ void DMA_CH_clear_flags(DMA_CHANNEL_REG_STRUCT* DMA_channelX, uint8_t flags){
+	// Write 1 to clear (DMA_IFCR)
+	DMA_CH_get_DMA(DMA_channelX)->IFCR.REG = ((uint32_t)(flags & DMAx_FLAG_ALL) << ((DMA_CH_get_number(DMA_channelX) - 1) << 2));
+}
+
 /**
  * @brief DMA Configuration
  * @param[in] instance DMA Configuration Structure
@@ -246,4 +293,45 @@ void DMA_Load_Default_PER2MEM(dma_config_t* instance);
  */
 void DMA_Load_Default_MEM2PER(dma_config_t* instance);
 
+/**
+ * @brief Allocates a DMA1 Channel for a DMA Request
+ * @param[in] DMA_channelX DMA Channel (`DMA1_Channel1` - `DMA1_Channel7`)
+ * @param[in] request `DMAx_REQ_xx` (e.g. `DMAx_REQ_USART1_TX`), `DMAx_REQ_MEM2MEM` fits any channel
+ * @returns - `0x00`: Failure (Channel owned by another request/Request not mapped to the channel)
+ * @returns - `0x01`: Success (also when the channel is already owned by the same request)
+ */
+uint8_t DMA_CH_Allocate(DMA_CHANNEL_REG_STRUCT* DMA_channelX, uint8_t request);
+
+/**
+ * @brief Releases a DMA1 Channel (disables it, clears its flags & callbacks)
+ * @param[in] DMA_channelX DMA Channel (`DMA1_Channel1` - `DMA1_Channel7`)
+ */
+void DMA_CH_Release(DMA_CHANNEL_REG_STRUCT* DMA_channelX);
+
+/**
+ * @brief Retrieves the owner of a DMA1 Channel
+ * @param[in] DMA_channelX DMA Channel (`DMA1_Channel1` - `DMA1_Channel7`)
+ * @returns `DMAx_REQ_xx` of the owner, `DMAx_REQ_NONE` if free
+ */
+uint8_t DMA_CH_Get_Owner(DMA_CHANNEL_REG_STRUCT* DMA_channelX);
+
+/**
+ * @brief Registers the Interrupt Callbacks of an allocated DMA1 Channel
+ * @param[in] DMA_channelX DMA Channel (`DMA1_Channel1` - `DMA1_Channel7`)
+ * @param[in] TC_Callback Transfer Complete Callback (may be NULL)
+ * @param[in] HT_Callback Half Transfer Callback (may be NULL)
+ * @param[in] TE_Callback Transfer Error Callback (may be NULL)
+ * @param[in] context User Context passed back to the callbacks
+ * @note Callbacks are executed in interrupt context, flags are already cleared
+ */
+void DMA_CH_Register_Callback(DMA_CHANNEL_REG_STRUCT* DMA_channelX, DMA_Callback_t TC_Callback,
+							  DMA_Callback_t HT_Callback, DMA_Callback_t TE_Callback, void* context);
+
+/**
+ * @brief Services the Interrupt of a DMA1 Channel
+ * @param[in] DMA_channelX DMA Channel (`DMA1_Channel1` - `DMA1_Channel7`)
+ * @note Clears the channel flags in DMA_IFCR, then calls TE -> HT -> TC callbacks
+ */
+void DMA_IRQ_Handler(DMA_CHANNEL_REG_STRUCT* DMA_channelX);
+
 #endif /* __DMA_H__ */
\ No newline at end of file
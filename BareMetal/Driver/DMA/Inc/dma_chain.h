@@ -0,0 +1,100 @@
+// Header Guards
+#ifndef __DMA_CHAIN_H__
+#define __DMA_CHAIN_H__
+
+// Address Mapping
+#include "reg_map.h"
+// DMA Channel Manager
+#include "dma.h"
+
+/**
+ ** DMA Transfer Chain (Software Scatter-Gather):
+ * - The STM32F1 DMA has no linked-list mode: a chain is a list of memory segments sharing one peripheral register
+ * - The TC interrupt reloads CMAR/CNDTR for the next segment (CCR/CPAR are kept), empty segments are skipped
+ * - Memory -> Peripheral (Gather): e.g. command header + framebuffer pages + wrapped ring-buffer spans sent as one stream
+ * - Peripheral -> Memory (Scatter): e.g. packet header and payload received into separate buffers
+ * - The peripheral request stays asserted during the reload, so no data is lost; the reload only adds
+ * 	 the interrupt latency between two segments
+ */
+
+// Forward Declaration
+typedef struct dma_chain dma_chain_t;
+
+// "DMA_Chain_Callback_t" is now a type representing:
+// "Pointer to any function taking DMA Chain, Status (`DMAx_CHAIN_STATUS_DONE`/`DMAx_CHAIN_STATUS_ERROR`) and returning void"
+typedef void (*DMA_Chain_Callback_t)(dma_chain_t* chain, uint8_t status);
+
+// DMA Chain Segment
+typedef struct {
+	// Memory Address (must stay valid until the chain completes)
+	void* address;
+	// Number of items (0 is skipped)
+	uint16_t count;
+} dma_segment_t;
+
+// DMA Transfer Chain (storage owned by the client until completion)
+struct dma_chain {
+	// DMA Channel (fixed by the peripheral request, e.g. `DMA1_Channel4` for `USART1` TX)
+	DMA_CHANNEL_REG_STRUCT* DMA_Channel;
+	// DMA Request `DMAx_REQ_xx` (e.g. `DMAx_REQ_USART1_TX`)
+	uint8_t request;
+	// Direction
+	// - `DMAx_DIR_READ_MEM`: Memory -> Peripheral (Gather)
+	// - `DMAx_DIR_READ_PER`: Peripheral -> Memory (Scatter)
+	uint8_t direction: 1;
+	// Priority
+	// - `DMAx_PRIORITY_LOW`
+	// - `DMAx_PRIORITY_MEDIUM`
+	// - `DMAx_PRIORITY_HIGH`
+	// - `DMAx_PRIORITY_VERY_HIGH`
+	uint8_t priority: 2;
+	// Peripheral Data Size (`PSIZE`): `DMAx_DATA_SIZE_BIT_8`, `DMAx_DATA_SIZE_BIT_16`, `DMAx_DATA_SIZE_BIT_32`
+	uint8_t perDataSize: 2;
+	// Memory Data Size (`MSIZE`): `DMAx_DATA_SIZE_BIT_8`, `DMAx_DATA_SIZE_BIT_16`, `DMAx_DATA_SIZE_BIT_32`
+	uint8_t memDataSize: 2;
+	// Peripheral Data Register Address (e.g. `&USART1->DR.REG`)
+	volatile void* peripheral;
+	// Segment List (must stay valid until the chain completes)
+	const dma_segment_t* segments;
+	// Number of segments
+	uint8_t num_segments;
+	// Completion Callback (executed in interrupt context, may be NULL)
+	DMA_Chain_Callback_t callback;
+	// User Context
+	void* context;
+
+	// Internal State (managed by the driver)
+	// Segment being transferred
+	volatile uint8_t index;
+	// Chain in progress
+	volatile uint8_t busy: 1;
+};
+
+/**
+ * @brief Starts a DMA Transfer Chain
+ * @param[in] chain Pointer to the DMA Transfer Chain
+ * @returns - `0x00`: Failure (Chain in progress/No data/DMA Channel owned by another request/Request not mapped to the channel)
+ * @returns - `0x01`: Success
+ * @note The peripheral DMA request (e.g. `USART_CR3_DMAT`) is enabled by the peripheral driver
+ */
+uint8_t DMA_Chain_Start(dma_chain_t* chain);
+
+/**
+ * @brief Aborts a DMA Transfer Chain and releases its DMA Channel
+ * @param[in] chain Pointer to the DMA Transfer Chain
+ * @note The completion callback is not called
+ */
+void DMA_Chain_Abort(dma_chain_t* chain);
+
+/**
+ * @brief Retrieves the state of a DMA Transfer Chain
+ * @param[in] chain Pointer to the DMA Transfer Chain
+ * @returns - `0x00`: Idle
+ * @returns - `0x01`: Chain in progress
+ */
+__STATIC_INLINE__ uint8_t DMA_Chain_Busy(dma_chain_t* chain){
+	// Chain State
+	return chain->busy;
+}
+
+#endif /* __DMA_CHAIN_H__ */
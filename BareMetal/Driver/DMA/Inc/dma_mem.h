@@ -0,0 +1,91 @@
+// Header Guards
+#ifndef __DMA_MEM_H__
+#define __DMA_MEM_H__
+
+// Address Mapping
+#include "reg_map.h"
+// DMA Channel Manager
+#include "dma.h"
+// memcpy(), memset()
+#include <string.h>
+// DWT Cycle Counter (Benchmark)
+#include "dwt.h"
+
+/**
+ ** DMA Memory Service:
+ * - Runs on `DMAx_MEM_CHANNEL` (allocated per request as `DMAx_REQ_MEM2MEM`, low priority so peripheral streams win arbitration)
+ * - Blocks shorter than `DMAx_MEM_CPU_THRESHOLD` are copied by the CPU: channel setup + TC interrupt cost more than the copy
+ * - Transfer Width:
+ * 	 |--- 32-bit: `src` & `dst` share the same word alignment (unaligned head bytes are copied by the CPU)
+ * 	 |--- 16-bit: `src` & `dst` share the same half-word alignment
+ * 	 |--- 8-bit: otherwise
+ * 	 |--- Tail bytes that do not fill a transfer unit are copied by the CPU before the DMA is started
+ * - Blocks longer than `DMAx_MEM_MAX_TRANSFERS` units are split and re-armed from the TC interrupt
+ * - Benchmarking: `DMA_Mem_Benchmark()` times `memcpy()` against `DMA_Memcpy()` for 64B - 4kB blocks
+ * 	 |--- `cpu`: `memcpy()`, the CPU is busy for the whole copy
+ * 	 |--- `dma`: `DMA_Memcpy()` until the TC interrupt completed it (latency of the copy)
+ * 	 |--- `dma_start`: `DMA_Memcpy()` call alone, the CPU is free for the rest of `dma`
+ */
+
+// "DMA_Mem_Callback_t" is now a type representing:
+// "Pointer to any function taking Status (`DMAx_MEM_STATUS_DONE`/`DMAx_MEM_STATUS_ERROR`), User Context and returning void"
+typedef void (*DMA_Mem_Callback_t)(uint8_t status, void* context);
+
+// CPU vs DMA Benchmark Results: core clock cycles per block of `DMAx_MEM_BENCHMARK_MIN_SIZE << i` bytes
+typedef struct {
+	// `memcpy()`
+	uint32_t cpu[DMAx_MEM_BENCHMARK_SIZES];
+	// `DMA_Memcpy()` until completion
+	uint32_t dma[DMAx_MEM_BENCHMARK_SIZES];
+	// `DMA_Memcpy()` call (channel setup, head & tail bytes)
+	uint32_t dma_start[DMAx_MEM_BENCHMARK_SIZES];
+} dma_mem_benchmark_t;
+
+/**
+ * @brief Starts an asynchronous Memory Copy
+ * @param[out] dst Destination (must stay valid until completion)
+ * @param[in] src Source (must stay valid & unmodified until completion)
+ * @param[in] len Number of bytes
+ * @param[in] callback Completion Callback (may be NULL)
+ * @param[in] context User Context passed back to the callback
+ * @returns - `0x00`: Failure (Service busy/DMA Channel owned by another request)
+ * @returns - `0x01`: Success (Copy started, or already completed by the CPU)
+ * @note - Regions must not overlap
+ * @note - `callback` is executed in interrupt context, or before returning when the CPU fallback is taken
+ */
+uint8_t DMA_Memcpy(void* dst, const void* src, uint32_t len, DMA_Mem_Callback_t callback, void* context);
+
+/**
+ * @brief Starts an asynchronous Memory Fill
+ * @param[out] dst Destination (must stay valid until completion)
+ * @param[in] value Fill Byte
+ * @param[in] len Number of bytes
+ * @param[in] callback Completion Callback (may be NULL)
+ * @param[in] context User Context passed back to the callback
+ * @returns - `0x00`: Failure (Service busy/DMA Channel owned by another request)
+ * @returns - `0x01`: Success (Fill started, or already completed by the CPU)
+ * @note `callback` is executed in interrupt context, or before returning when the CPU fallback is taken
+ */
+uint8_t DMA_Memset(void* dst, uint8_t value, uint32_t len, DMA_Mem_Callback_t callback, void* context);
+
+/**
+ * @brief Retrieves the state of the DMA Memory Service
+ * @returns - `0x00`: Idle
+ * @returns - `0x01`: Transfer in progress
+ */
+uint8_t DMA_Mem_Busy(void);
+
+/**
+ * @brief Measures `memcpy()` against `DMA_Memcpy()` for 64B - 4kB blocks (DWT cycle counter)
+ * @param[out] dst Destination (`DMAx_MEM_BENCHMARK_MAX_SIZE` bytes, word aligned for 32-bit transfers)
+ * @param[in] src Source (`DMAx_MEM_BENCHMARK_MAX_SIZE` bytes, must not overlap `dst`)
+ * @param[out] result Cycles per block of each method
+ * @returns - `0x00`: Failure (No buffers/Service busy/DMA Channel owned by another request/Transfer error/Copy mismatch)
+ * @returns - `0x01`: Success
+ * @note - Blocks until done, interrupts stay enabled (the DMA completes from its TC interrupt):
+ * 		   other interrupts firing during a measurement inflate it
+ * @note - `src` is filled with a test pattern
+ */
+uint8_t DMA_Mem_Benchmark(void* dst, void* src, dma_mem_benchmark_t* result);
+
+#endif /* __DMA_MEM_H__ */
@@ -0,0 +1,91 @@
+// Header Guards
+#ifndef __DMA_STREAM_H__
+#define __DMA_STREAM_H__
+
+// Address Mapping
+#include "reg_map.h"
+// DMA Channel Manager
+#include "dma.h"
+
+/**
+ ** Circular Double Buffer (Ping-Pong):
+ * - `buffer` holds `count` items split into two halves of `count / 2` items
+ * - Peripheral -> Memory (ADC, USART RX, Timer Capture):
+ * 	 |--- HT: first half filled, handed to `callback` while the DMA fills the second half
+ * 	 |--- TC: second half filled, handed to `callback` while the DMA wraps to the first half
+ * - Memory -> Peripheral (Timer CCR/ARR, USART TX patterns):
+ * 	 |--- HT/TC: the half just consumed is handed to `callback` to be refilled
+ * - `callback` runs in interrupt context and must finish within the time the DMA needs for one half,
+ * 	 otherwise `overrun` is incremented (the DMA already moved past the half being reported)
+ */
+
+// Forward Declaration
+typedef struct dma_stream dma_stream_t;
+
+// "DMA_Stream_Callback_t" is now a type representing:
+// "Pointer to any function taking DMA Stream, Pointer to the finished half, Number of items in the half and returning void"
+typedef void (*DMA_Stream_Callback_t)(dma_stream_t* stream, void* half, uint16_t count);
+
+// DMA Stream (storage owned by the client while the stream runs)
+struct dma_stream {
+	// DMA Channel (fixed by the peripheral request, e.g. `DMA1_Channel1` for `ADC1`)
+	DMA_CHANNEL_REG_STRUCT* DMA_Channel;
+	// DMA Request `DMAx_REQ_xx` (e.g. `DMAx_REQ_ADC1`)
+	uint8_t request;
+	// Direction
+	// - `DMAx_DIR_READ_PER`: Peripheral -> Memory
+	// - `DMAx_DIR_READ_MEM`: Memory -> Peripheral
+	uint8_t direction: 1;
+	// Priority
+	// - `DMAx_PRIORITY_LOW`
+	// - `DMAx_PRIORITY_MEDIUM`
+	// - `DMAx_PRIORITY_HIGH`
+	// - `DMAx_PRIORITY_VERY_HIGH`
+	uint8_t priority: 2;
+	// Peripheral Data Size (`PSIZE`): `DMAx_DATA_SIZE_BIT_8`, `DMAx_DATA_SIZE_BIT_16`, `DMAx_DATA_SIZE_BIT_32`
+	uint8_t perDataSize: 2;
+	// Memory Data Size (`MSIZE`): `DMAx_DATA_SIZE_BIT_8`, `DMAx_DATA_SIZE_BIT_16`, `DMAx_DATA_SIZE_BIT_32`
+	uint8_t memDataSize: 2;
+	// Peripheral Data Register Address (e.g. `&ADC1->DR.REG`)
+	volatile void* peripheral;
+	// Circular Buffer
+	void* buffer;
+	// Number of items in `buffer` (even, >= 2)
+	uint16_t count;
+	// Half Processing Callback
+	DMA_Stream_Callback_t callback;
+	// User Context
+	void* context;
+
+	// Internal State (managed by the driver)
+	// Stream running
+	volatile uint8_t running: 1;
+	// Halves reported late (callback slower than the DMA)
+	volatile uint32_t overrun;
+	// Transfer Errors (stream stopped)
+	volatile uint32_t errors;
+};
+
+/**
+ * @brief Starts a circular DMA Stream
+ * @param[in] stream Pointer to the DMA Stream (must stay valid while running)
+ * @returns - `0x00`: Failure (Odd/Zero count/DMA Channel owned by another request/Request not mapped to the channel)
+ * @returns - `0x01`: Success
+ * @note The peripheral DMA request (e.g. `ADC_CR2_DMA`, `USART_CR3_DMAR`) is enabled by the peripheral driver
+ */
+uint8_t DMA_Stream_Start(dma_stream_t* stream);
+
+/**
+ * @brief Stops a DMA Stream and releases its DMA Channel
+ * @param[in] stream Pointer to the DMA Stream
+ */
+void DMA_Stream_Stop(dma_stream_t* stream);
+
+/**
+ * @brief Retrieves the current position of the DMA in the circular buffer
+ * @param[in] stream Pointer to the DMA Stream
+ * @returns Index of the next item to be transferred (0 - `count - 1`)
+ */
+uint16_t DMA_Stream_Get_Position(dma_stream_t* stream);
+
+#endif /* __DMA_STREAM_H__ */
@@ -1,6 +1,36 @@
 // Library
 #include "dma.h"
 
+// DMA1 Channel Handle
+typedef struct {
+	// Owner Request (`DMAx_REQ_NONE` if free)
+	uint8_t request;
+	// Transfer Complete Callback
+	DMA_Callback_t TC_Callback;
+	// Half Transfer Callback
+	DMA_Callback_t HT_Callback;
+	// Transfer Error Callback
+	DMA_Callback_t TE_Callback;
+	// User Context
+	void* context;
+} dma_channel_handle_t;
+
+// DMA1 Channel Handles: [0] -> Channel 1 ... [6] -> Channel 7
+static dma_channel_handle_t dma_channel[DMA1_NUM_CHANNELS] = {0};
+
+/**
+ * @brief Retrieves the Handle of a DMA1 Channel
+ * @param[in] DMA_channelX DMA Channel
+ * @returns Pointer to the Channel Handle, NULL if not a DMA1 Channel
+ */
+__STATIC_INLINE__ dma_channel_handle_t* DMA_CH_Get_Handle(DMA_CHANNEL_REG_STRUCT* DMA_channelX){
+	// Only DMA1 is available on the STM32F103C8T6
+	if(DMA_CH_get_DMA(DMA_channelX) != DMA1)
+		return NULL;
+	// Channel Handle
+	return &dma_channel[DMA_CH_get_number(DMA_channelX) - 1];
+}
+
 /**
  * @brief DMA Configuration
  * @param[in] instance DMA Configuration Structure
@@ -149,3 +179,170 @@ void DMA_Load_Default_MEM2PER(dma_config_t* instance){
 	instance->channel.priority = DMAx_PRIORITY_HIGH;	
 }
 
+/**
+ * @brief Allocates a DMA1 Channel for a DMA Request
+ * @param[in] DMA_channelX DMA Channel (`DMA1_Channel1` - `DMA1_Channel7`)
+ * @param[in] request `DMAx_REQ_xx` (e.g. `DMAx_REQ_USART1_TX`), `DMAx_REQ_MEM2MEM` fits any channel
+ * @returns - `0x00`: Failure (Channel owned by another request/Request not mapped to the channel)
+ * @returns - `0x01`: Success (also when the channel is already owned by the same request)
+ */
+uint8_t DMA_CH_Allocate(DMA_CHANNEL_REG_STRUCT* DMA_channelX, uint8_t request){
+	// Local Variables
+	dma_channel_handle_t* handle = DMA_CH_Get_Handle(DMA_channelX);
+	uint8_t result = 0x00;
+	// Not a DMA1 Channel/Invalid Request
+	if((handle == NULL) || (request == DMAx_REQ_NONE))
+		return 0x00;
+	// Fixed Request Mapping (Memory to Memory fits any channel)
+	if((DMAx_REQ_GET_CHANNEL(request) != 0) && (DMAx_REQ_GET_CHANNEL(request) != DMA_CH_get_number(DMA_channelX)))
+		return 0x00;
+	// Disable Global Interrupt
+	__disable_irq();
+	// Free or already owned by the same request
+	if((handle->request == DMAx_REQ_NONE) || (handle->request == request)){
+		handle->request = request;
+		result = 0x01;
+	}
+	// Enable Global Interrupt
+	__enable_irq();
+	// Result
+	return result;
+}
+
+/**
+ * @brief Releases a DMA1 Channel (disables it, clears its flags & callbacks)
+ * @param[in] DMA_channelX DMA Channel (`DMA1_Channel1` - `DMA1_Channel7`)
+ */
+void DMA_CH_Release(DMA_CHANNEL_REG_STRUCT* DMA_channelX){
+	// Local Variable
+	dma_channel_handle_t* handle = DMA_CH_Get_Handle(DMA_channelX);
+	// Not a DMA1 Channel
+	if(handle == NULL)
+		return;
+	// Stop the Channel
+	DMA_CH_disable(DMA_channelX);
+	DMA_CH_clear_flags(DMA_channelX, DMAx_FLAG_ALL);
+	// Disable Global Interrupt
+	__disable_irq();
+	// Free the Handle
+	handle->request = DMAx_REQ_NONE;
+	handle->TC_Callback = NULL;
+	handle->HT_Callback = NULL;
+	handle->TE_Callback = NULL;
+	handle->context = NULL;
+	// Enable Global Interrupt
+	__enable_irq();
+}
+
+/**
+ * @brief Retrieves the owner of a DMA1 Channel
+ * @param[in] DMA_channelX DMA Channel (`DMA1_Channel1` - `DMA1_Channel7`)
+ * @returns `DMAx_REQ_xx` of the owner, `DMAx_REQ_NONE` if free
+ */
+uint8_t DMA_CH_Get_Owner(DMA_CHANNEL_REG_STRUCT* DMA_channelX){
+	// Local Variable
+	dma_channel_handle_t* handle = DMA_CH_Get_Handle(DMA_channelX);
+	// Owner
+	return (handle == NULL) ? DMAx_REQ_NONE : handle->request;
+}
+
+/**
+ * @brief Registers the Interrupt Callbacks of an allocated DMA1 Channel
+ * @param[in] DMA_channelX DMA Channel (`DMA1_Channel1` - `DMA1_Channel7`)
+ * @param[in] TC_Callback Transfer Complete Callback (may be NULL)
+ * @param[in] HT_Callback Half Transfer Callback (may be NULL)
+ * @param[in] TE_Callback Transfer Error Callback (may be NULL)
+ * @param[in] context User Context passed back to the callbacks
+ * @note Callbacks are executed in interrupt context, flags are already cleared
+ */
+void DMA_CH_Register_Callback(DMA_CHANNEL_REG_STRUCT* DMA_channelX, DMA_Callback_t TC_Callback,
+							  DMA_Callback_t HT_Callback, DMA_Callback_t TE_Callback, void* context){
+	// Local Variable
+	dma_channel_handle_t* handle = DMA_CH_Get_Handle(DMA_channelX);
+	// Not a DMA1 Channel
+	if(handle == NULL)
+		return;
+	// Disable Global Interrupt
+	__disable_irq();
+	// Register Callbacks
+	handle->TC_Callback = TC_Callback;
+	handle->HT_Callback = HT_Callback;
+	handle->TE_Callback = TE_Callback;
+	handle->context = context;
+	// Enable Global Interrupt
+	__enable_irq();
+}
+
+/**
+ * @brief Services the Interrupt of a DMA1 Channel
+ * @param[in] DMA_channelX DMA Channel (`DMA1_Channel1` - `DMA1_Channel7`)
+ * @note Clears the channel flags in DMA_IFCR, then calls TE -> HT -> TC callbacks
+ */
+void DMA_IRQ_Handler(DMA_CHANNEL_REG_STRUCT* DMA_channelX){
+	// Local Variables
+	dma_channel_handle_t* handle = DMA_CH_Get_Handle(DMA_channelX);
+	uint8_t flags = DMA_CH_get_flags(DMA_channelX);
+	// Clear the serviced flags (a callback may re-arm the channel)
+	DMA_CH_clear_flags(DMA_channelX, flags);
+	// Not a DMA1 Channel
+	if(handle == NULL)
+		return;
+	// Transfer Error: hardware already disabled the channel
+	if((flags & DMAx_FLAG_TEIF) && (handle->TE_Callback != NULL))
+		handle->TE_Callback(DMA_channelX, handle->context);
+	// Half Transfer
+	if((flags & DMAx_FLAG_HTIF) && (handle->HT_Callback != NULL))
+		handle->HT_Callback(DMA_channelX, handle->context);
+	// Transfer Complete
+	if((flags & DMAx_FLAG_TCIF) && (handle->TC_Callback != NULL))
+		handle->TC_Callback(DMA_channelX, handle->context);
+}
+
+/**
+ * @brief DMA1 Channel 1 ISR
+ */
+__attribute__((weak)) void DMA1_Channel1_IRQHandler(void){
+	DMA_IRQ_Handler(DMA1_Channel1);
+}
+
+/**
+ * @brief DMA1 Channel 2 ISR
+ */
+__attribute__((weak)) void DMA1_Channel2_IRQHandler(void){
+	DMA_IRQ_Handler(DMA1_Channel2);
+}
+
+/**
+ * @brief DMA1 Channel 3 ISR
+ */
+__attribute__((weak)) void DMA1_Channel3_IRQHandler(void){
+	DMA_IRQ_Handler(DMA1_Channel3);
+}
+
+/**
+ * @brief DMA1 Channel 4 ISR
+ */
+__attribute__((weak)) void DMA1_Channel4_IRQHandler(void){
+	DMA_IRQ_Handler(DMA1_Channel4);
+}
+
+/**
+ * @brief DMA1 Channel 5 ISR
+ */
+__attribute__((weak)) void DMA1_Channel5_IRQHandler(void){
+	DMA_IRQ_Handler(DMA1_Channel5);
+}
+
+/**
+ * @brief DMA1 Channel 6 ISR
+ */
+__attribute__((weak)) void DMA1_Channel6_IRQHandler(void){
+	DMA_IRQ_Handler(DMA1_Channel6);
+}
+
+/**
+ * @brief DMA1 Channel 7 ISR
+ */
+__attribute__((weak)) void DMA1_Channel7_IRQHandler(void){
+	DMA_IRQ_Handler(DMA1_Channel7);
+}
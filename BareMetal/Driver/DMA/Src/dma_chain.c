@@ -0,0 +1,139 @@
+// Header
+#include "dma_chain.h"
+
+/**
+ * @brief Loads the next non-empty segment (from `chain->index`) into the DMA Channel
+ * @param[in] chain Pointer to the DMA Transfer Chain
+ * @returns - `0x00`: No segment left
+ * @returns - `0x01`: Segment started
+ * @note Only CMAR & CNDTR are rewritten: CCR (except EN) & CPAR are kept from the first segment
+ */
+static uint8_t DMA_Chain_Load(dma_chain_t* chain){
+	// Local Variable
+	DMA_CHANNEL_REG_STRUCT* DMA_channelX = chain->DMA_Channel;
+	// Skip empty segments
+	while((chain->index < chain->num_segments) && (chain->segments[chain->index].count == 0))
+		chain->index++;
+	// End of chain
+	if(chain->index >= chain->num_segments)
+		return 0x00;
+	// CMAR/CNDTR are writable only while EN = 0
+	DMA_channelX->CCR.REG &= ~DMA_CCR_EN;
+	// Memory side is CMAR in both directions
+	DMA_channelX->CMAR.REG = (uint32_t)chain->segments[chain->index].address;
+	DMA_channelX->CNDTR.REG = chain->segments[chain->index].count;
+	// Restart
+	DMA_channelX->CCR.REG |= DMA_CCR_EN;
+	// Segment started
+	return 0x01;
+}
+
+/**
+ * @brief Completes the chain and notifies the user
+ * @param[in] chain Pointer to the DMA Transfer Chain
+ * @param[in] status `DMAx_CHAIN_STATUS_DONE`, `DMAx_CHAIN_STATUS_ERROR`
+ */
+static void DMA_Chain_Finish(dma_chain_t* chain, uint8_t status){
+	// Free the Channel
+	DMA_CH_Release(chain->DMA_Channel);
+	// Update State
+	chain->busy = 0x00;
+	// User Callback (may start the next chain)
+	if(chain->callback != NULL)
+		chain->callback(chain, status);
+}
+
+/**
+ * @brief DMA Transfer Complete Callback: reloads the next segment
+ * @param[in] DMA_channelX DMA Channel
+ * @param[in] context DMA Transfer Chain
+ */
+static void DMA_Chain_TC_Callback(DMA_CHANNEL_REG_STRUCT* DMA_channelX, void* context){
+	// Local Variable
+	dma_chain_t* chain = (dma_chain_t *)context;
+	// Next Segment
+	chain->index++;
+	if(!DMA_Chain_Load(chain))
+		DMA_Chain_Finish(chain, DMAx_CHAIN_STATUS_DONE);
+}
+
+/**
+ * @brief DMA Transfer Error Callback: hardware disabled the channel
+ * @param[in] DMA_channelX DMA Channel
+ * @param[in] context DMA Transfer Chain
+ */
+static void DMA_Chain_TE_Callback(DMA_CHANNEL_REG_STRUCT* DMA_channelX, void* context){
+	// Abort the Chain
+	DMA_Chain_Finish((dma_chain_t *)context, DMAx_CHAIN_STATUS_ERROR);
+}
+
+/**
+ * @brief Starts a DMA Transfer Chain
+ * @param[in] chain Pointer to the DMA Transfer Chain
+ * @returns - `0x00`: Failure (Chain in progress/No data/DMA Channel owned by another request/Request not mapped to the channel)
+ * @returns - `0x01`: Success
+ * @note The peripheral DMA request (e.g. `USART_CR3_DMAT`) is enabled by the peripheral driver
+ */
+uint8_t DMA_Chain_Start(dma_chain_t* chain){
+	// Local Variable
+	dma_config_t dma_config = {0};
+	// Chain in progress/No segments
+	if(chain->busy || (chain->segments == NULL) || (chain->num_segments == 0))
+		return 0x00;
+	// Claim the Channel
+	if(!DMA_CH_Allocate(chain->DMA_Channel, chain->request))
+		return 0x00;
+
+	// Channel Configuration: Normal Mode, Transfer Complete reloads
+	dma_config.DMA_Channel = chain->DMA_Channel;
+	dma_config.channel.direction = chain->direction;
+	dma_config.channel.mem2mem = DMAx_MEM2MEM_DISABLE;
+	dma_config.channel.circular_mode = DMAx_CIRC_DISABLE;
+	dma_config.channel.priority = chain->priority;
+	// Source/Destination are swapped by DMA_Config() for Memory -> Peripheral
+	if(chain->direction == DMAx_DIR_READ_MEM){
+		dma_config.data.srcDataSize = chain->memDataSize;
+		dma_config.data.dstDataSize = chain->perDataSize;
+		dma_config.data.srcInc = DMAx_INC_ENABLE;
+		dma_config.data.dstInc = DMAx_INC_DISABLE;
+	}
+	else{
+		dma_config.data.srcDataSize = chain->perDataSize;
+		dma_config.data.dstDataSize = chain->memDataSize;
+		dma_config.data.srcInc = DMAx_INC_DISABLE;
+		dma_config.data.dstInc = DMAx_INC_ENABLE;
+	}
+	dma_config.interrupt.TCIE = DMAx_IRQ_ENABLE;
+	dma_config.interrupt.HTIE = DMAx_IRQ_DISABLE;
+	dma_config.interrupt.TEIE = DMAx_IRQ_ENABLE;
+	DMA_Config(&dma_config);
+	DMA_CH_clear_flags(chain->DMA_Channel, DMAx_FLAG_ALL);
+	DMA_CH_Register_Callback(chain->DMA_Channel, DMA_Chain_TC_Callback, NULL, DMA_Chain_TE_Callback, chain);
+	// Peripheral Register is shared by all segments
+	chain->DMA_Channel->CPAR.REG = (uint32_t)chain->peripheral;
+
+	// Start the first non-empty segment
+	chain->index = 0x00;
+	chain->busy = 0x01;
+	if(!DMA_Chain_Load(chain)){
+		DMA_CH_Release(chain->DMA_Channel);
+		chain->busy = 0x00;
+		return 0x00;
+	}
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Aborts a DMA Transfer Chain and releases its DMA Channel
+ * @param[in] chain Pointer to the DMA Transfer Chain
+ * @note The completion callback is not called
+ */
+void DMA_Chain_Abort(dma_chain_t* chain){
+	// Not in progress
+	if(!chain->busy)
+		return;
+	// Disable the Channel + Free it for other requests
+	DMA_CH_Release(chain->DMA_Channel);
+	chain->busy = 0x00;
+}
@@ -0,0 +1,299 @@
+// Header
+#include "dma_mem.h"
+
+// DMA Memory Transfer Handle
+typedef struct {
+	// Transfer in progress
+	volatile uint8_t busy;
+	// Transfer Width: `DMAx_DATA_SIZE_BIT_8`, `DMAx_DATA_SIZE_BIT_16`, `DMAx_DATA_SIZE_BIT_32`
+	uint8_t width;
+	// Fill (Source does not increment)
+	uint8_t fill;
+	// Next Source Address
+	uint32_t src;
+	// Next Destination Address
+	uint32_t dst;
+	// Remaining transfer units
+	uint32_t units;
+	// Fill Pattern (read by the DMA, replicated over a word)
+	uint32_t pattern;
+	// Completion Callback
+	DMA_Mem_Callback_t callback;
+	// User Context
+	void* context;
+} dma_mem_handle_t;
+
+// DMA Memory Transfer Handle
+static dma_mem_handle_t dma_mem = {0};
+
+/**
+ * @brief Programs the next chunk of the transfer (at most `DMAx_MEM_MAX_TRANSFERS` units)
+ */
+static void DMA_Mem_Next_Chunk(void){
+	// Local Variable
+	uint32_t count = (dma_mem.units > DMAx_MEM_MAX_TRANSFERS) ? DMAx_MEM_MAX_TRANSFERS : dma_mem.units;
+	// MEM2MEM with DIR = 0: CPAR (Source) -> CMAR (Destination)
+	DMA_Transfer_Config(DMAx_MEM_CHANNEL, (void *)dma_mem.src, (void *)dma_mem.dst, (uint16_t)count);
+	// Advance for the following chunk
+	dma_mem.dst += (count << dma_mem.width);
+	if(!dma_mem.fill)
+		dma_mem.src += (count << dma_mem.width);
+	dma_mem.units -= count;
+	// Start
+	DMA_CH_enable(DMAx_MEM_CHANNEL);
+}
+
+/**
+ * @brief Completes the transfer and notifies the user
+ * @param[in] status `DMAx_MEM_STATUS_DONE`, `DMAx_MEM_STATUS_ERROR`
+ */
+static void DMA_Mem_Finish(uint8_t status){
+	// Local Variables: a callback may start the next transfer
+	DMA_Mem_Callback_t callback = dma_mem.callback;
+	void* context = dma_mem.context;
+	// Free the Channel
+	DMA_CH_Release(DMAx_MEM_CHANNEL);
+	// Update State
+	dma_mem.busy = 0x00;
+	// User Callback
+	if(callback != NULL)
+		callback(status, context);
+}
+
+/**
+ * @brief DMA Transfer Complete Callback
+ * @param[in] DMA_channelX DMA Channel
+ * @param[in] context Unused
+ */
+static void DMA_Mem_TC_Callback(DMA_CHANNEL_REG_STRUCT* DMA_channelX, void* context){
+	// More chunks pending
+	if(dma_mem.units)
+		DMA_Mem_Next_Chunk();
+	// Done
+	else
+		DMA_Mem_Finish(DMAx_MEM_STATUS_DONE);
+}
+
+/**
+ * @brief DMA Transfer Error Callback
+ * @param[in] DMA_channelX DMA Channel
+ * @param[in] context Unused
+ */
+static void DMA_Mem_TE_Callback(DMA_CHANNEL_REG_STRUCT* DMA_channelX, void* context){
+	// Hardware already disabled the channel
+	DMA_Mem_Finish(DMAx_MEM_STATUS_ERROR);
+}
+
+/**
+ * @brief Copies/Fills bytes with the CPU
+ * @param[out] dst Destination
+ * @param[in] src Source
+ * @param[in] value Fill Byte (`fill` only)
+ * @param[in] len Number of bytes
+ * @param[in] fill `0x00`: Copy, `0x01`: Fill
+ */
+__STATIC_INLINE__ void DMA_Mem_CPU(uint8_t* dst, const uint8_t* src, uint8_t value, uint32_t len, uint8_t fill){
+	// Fill
+	if(fill)
+		memset(dst, value, len);
+	// Copy
+	else
+		memcpy(dst, src, len);
+}
+
+/**
+ * @brief Starts a Memory Copy/Fill
+ * @param[out] dst Destination
+ * @param[in] src Source (`NULL` for fill)
+ * @param[in] value Fill Byte
+ * @param[in] len Number of bytes
+ * @param[in] callback Completion Callback (may be NULL)
+ * @param[in] context User Context passed back to the callback
+ * @returns - `0x00`: Failure (Service busy/DMA Channel owned by another request)
+ * @returns - `0x01`: Success
+ */
+static uint8_t DMA_Mem_Start(uint8_t* dst, const uint8_t* src, uint8_t value, uint32_t len, DMA_Mem_Callback_t callback, void* context){
+	// Local Variables
+	uint8_t fill = (src == NULL);
+	uint8_t width = DMAx_DATA_SIZE_BIT_32;
+	uint32_t head = 0x00;
+	uint32_t tail = 0x00;
+	dma_config_t dma_config = {0};
+
+	// Claim the Service
+	__disable_irq();
+	if(dma_mem.busy){
+		__enable_irq();
+		return 0x00;
+	}
+	dma_mem.busy = 0x01;
+	__enable_irq();
+
+	// Transfer Width: both addresses must reach the same alignment
+	if(!fill){
+		if(((uint32_t)dst ^ (uint32_t)src) & 0x01)
+			width = DMAx_DATA_SIZE_BIT_8;
+		else if(((uint32_t)dst ^ (uint32_t)src) & 0x02)
+			width = DMAx_DATA_SIZE_BIT_16;
+	}
+	// Unaligned Head & Tail bytes
+	head = (0x00 - (uint32_t)dst) & ((1UL << width) - 1);
+	if(head < len)
+		tail = (len - head) & ((1UL << width) - 1);
+
+	// Short block (or nothing left for the DMA): CPU is faster
+	if((len < DMAx_MEM_CPU_THRESHOLD) || (len <= (head + tail))){
+		DMA_Mem_CPU(dst, src, value, len, fill);
+		dma_mem.busy = 0x00;
+		// User Callback
+		if(callback != NULL)
+			callback(DMAx_MEM_STATUS_DONE, context);
+		// Success
+		return 0x01;
+	}
+	// Channel owned by another request
+	if(!DMA_CH_Allocate(DMAx_MEM_CHANNEL, DMAx_REQ_MEM2MEM)){
+		dma_mem.busy = 0x00;
+		return 0x00;
+	}
+
+	// Head & Tail by the CPU (regions do not overlap the DMA part)
+	DMA_Mem_CPU(dst, src, value, head, fill);
+	DMA_Mem_CPU(dst + (len - tail), fill ? NULL : (src + (len - tail)), value, tail, fill);
+
+	// Transfer Handle
+	dma_mem.width = width;
+	dma_mem.fill = fill;
+	dma_mem.pattern = (uint32_t)value * 0x01010101UL;
+	dma_mem.src = fill ? (uint32_t)&dma_mem.pattern : (uint32_t)(src + head);
+	dma_mem.dst = (uint32_t)(dst + head);
+	dma_mem.units = (len - head - tail) >> width;
+	dma_mem.callback = callback;
+	dma_mem.context = context;
+
+	// Channel Configuration: Memory to Memory, low priority
+	dma_config.DMA_Channel = DMAx_MEM_CHANNEL;
+	dma_config.channel.direction = DMAx_DIR_READ_PER;
+	dma_config.channel.mem2mem = DMAx_MEM2MEM_ENABLE;
+	dma_config.channel.circular_mode = DMAx_CIRC_DISABLE;
+	dma_config.channel.priority = DMAx_PRIORITY_LOW;
+	dma_config.data.srcDataSize = width;
+	dma_config.data.dstDataSize = width;
+	dma_config.data.srcInc = fill ? DMAx_INC_DISABLE : DMAx_INC_ENABLE;
+	dma_config.data.dstInc = DMAx_INC_ENABLE;
+	dma_config.interrupt.TCIE = DMAx_IRQ_ENABLE;
+	dma_config.interrupt.HTIE = DMAx_IRQ_DISABLE;
+	dma_config.interrupt.TEIE = DMAx_IRQ_ENABLE;
+	DMA_Config(&dma_config);
+	DMA_CH_clear_flags(DMAx_MEM_CHANNEL, DMAx_FLAG_ALL);
+	DMA_CH_Register_Callback(DMAx_MEM_CHANNEL, DMA_Mem_TC_Callback, NULL, DMA_Mem_TE_Callback, NULL);
+
+	// Start the first chunk
+	DMA_Mem_Next_Chunk();
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Starts an asynchronous Memory Copy
+ * @param[out] dst Destination (must stay valid until completion)
+ * @param[in] src Source (must stay valid & unmodified until completion)
+ * @param[in] len Number of bytes
+ * @param[in] callback Completion Callback (may be NULL)
+ * @param[in] context User Context passed back to the callback
+ * @returns - `0x00`: Failure (Service busy/DMA Channel owned by another request)
+ * @returns - `0x01`: Success (Copy started, or already completed by the CPU)
+ * @note - Regions must not overlap
+ * @note - `callback` is executed in interrupt context, or before returning when the CPU fallback is taken
+ */
+uint8_t DMA_Memcpy(void* dst, const void* src, uint32_t len, DMA_Mem_Callback_t callback, void* context){
+	// Copy
+	return DMA_Mem_Start((uint8_t *)dst, (const uint8_t *)src, 0x00, len, callback, context);
+}
+
+/**
+ * @brief Starts an asynchronous Memory Fill
+ * @param[out] dst Destination (must stay valid until completion)
+ * @param[in] value Fill Byte
+ * @param[in] len Number of bytes
+ * @param[in] callback Completion Callback (may be NULL)
+ * @param[in] context User Context passed back to the callback
+ * @returns - `0x00`: Failure (Service busy/DMA Channel owned by another request)
+ * @returns - `0x01`: Success (Fill started, or already completed by the CPU)
+ * @note `callback` is executed in interrupt context, or before returning when the CPU fallback is taken
+ */
+uint8_t DMA_Memset(void* dst, uint8_t value, uint32_t len, DMA_Mem_Callback_t callback, void* context){
+	// Fill
+	return DMA_Mem_Start((uint8_t *)dst, NULL, value, len, callback, context);
+}
+
+/**
+ * @brief Retrieves the state of the DMA Memory Service
+ * @returns - `0x00`: Idle
+ * @returns - `0x01`: Transfer in progress
+ */
+uint8_t DMA_Mem_Busy(void){
+	// Transfer State
+	return dma_mem.busy;
+}
+
+/**
+ * @brief Benchmark Completion Callback
+ * @param[in] status `DMAx_MEM_STATUS_DONE`, `DMAx_MEM_STATUS_ERROR`
+ * @param[in] context Pointer to the status storage
+ */
+static void DMA_Mem_Benchmark_Callback(uint8_t status, void* context){
+	// Report the status to the polling loop
+	*(volatile uint8_t *)context = status;
+}
+
+/**
+ * @brief Measures `memcpy()` against `DMA_Memcpy()` for 64B - 4kB blocks (DWT cycle counter)
+ * @param[out] dst Destination (`DMAx_MEM_BENCHMARK_MAX_SIZE` bytes, word aligned for 32-bit transfers)
+ * @param[in] src Source (`DMAx_MEM_BENCHMARK_MAX_SIZE` bytes, must not overlap `dst`)
+ * @param[out] result Cycles per block of each method
+ * @returns - `0x00`: Failure (No buffers/Service busy/DMA Channel owned by another request/Transfer error/Copy mismatch)
+ * @returns - `0x01`: Success
+ * @note - Blocks until done, interrupts stay enabled (the DMA completes from its TC interrupt):
+ * 		   other interrupts firing during a measurement inflate it
+ * @note - `src` is filled with a test pattern
+ */
+uint8_t DMA_Mem_Benchmark(void* dst, void* src, dma_mem_benchmark_t* result){
+	// Local Variables
+	volatile uint8_t status = DMAx_MEM_STATUS_ERROR;
+	uint32_t overhead = 0;
+	uint32_t len = 0;
+	uint32_t i = 0;
+	// Invalid Arguments
+	if((dst == NULL) || (src == NULL) || (result == NULL))
+		return 0x00;
+	// Test Pattern (no zero run: a missed byte shows up in the check)
+	for(i = 0; i < DMAx_MEM_BENCHMARK_MAX_SIZE; i++)
+		((uint8_t *)src)[i] = (uint8_t)((i * 31U) + 1U);
+	// Counter overhead (start + read)
+	DWT_Cycle_Counter_Start();
+	overhead = DWT_Cycle_Counter_Get();
+
+	for(i = 0; i < DMAx_MEM_BENCHMARK_SIZES; i++){
+		len = (uint32_t)DMAx_MEM_BENCHMARK_MIN_SIZE << i;
+		// CPU Copy
+		memset(dst, 0, len);
+		DWT_Cycle_Counter_Start();
+		memcpy(dst, src, len);
+		result->cpu[i] = DWT_Cycle_Counter_Get() - overhead;
+		// DMA Copy: setup, then completion (TC interrupt clears `busy`)
+		memset(dst, 0, len);
+		status = DMAx_MEM_STATUS_ERROR;
+		DWT_Cycle_Counter_Start();
+		if(!DMA_Memcpy(dst, src, len, DMA_Mem_Benchmark_Callback, (void *)&status))
+			return 0x00;
+		result->dma_start[i] = DWT_Cycle_Counter_Get() - overhead;
+		while(DMA_Mem_Busy());
+		result->dma[i] = DWT_Cycle_Counter_Get() - overhead;
+		// Transfer error/Copy mismatch
+		if((status != DMAx_MEM_STATUS_DONE) || memcmp(dst, src, len))
+			return 0x00;
+	}
+	// Success
+	return 0x01;
+}
@@ -0,0 +1,132 @@
+// Header
+#include "dma_stream.h"
+
+/**
+ * @brief DMA Half Transfer Callback: first half finished
+ * @param[in] DMA_channelX DMA Channel
+ * @param[in] context DMA Stream
+ */
+static void DMA_Stream_HT_Callback(DMA_CHANNEL_REG_STRUCT* DMA_channelX, void* context){
+	// Local Variables
+	dma_stream_t* stream = (dma_stream_t *)context;
+	uint16_t half = stream->count >> 1;
+	// DMA already wrapped into the first half
+	if(DMA_Stream_Get_Position(stream) < half)
+		stream->overrun++;
+	// First Half
+	if(stream->callback != NULL)
+		stream->callback(stream, stream->buffer, half);
+}
+
+/**
+ * @brief DMA Transfer Complete Callback: second half finished
+ * @param[in] DMA_channelX DMA Channel
+ * @param[in] context DMA Stream
+ */
+static void DMA_Stream_TC_Callback(DMA_CHANNEL_REG_STRUCT* DMA_channelX, void* context){
+	// Local Variables
+	dma_stream_t* stream = (dma_stream_t *)context;
+	uint16_t half = stream->count >> 1;
+	// DMA already moved into the second half
+	if(DMA_Stream_Get_Position(stream) >= half)
+		stream->overrun++;
+	// Second Half
+	if(stream->callback != NULL)
+		stream->callback(stream, (uint8_t *)stream->buffer + ((uint32_t)half << stream->memDataSize), half);
+}
+
+/**
+ * @brief DMA Transfer Error Callback: hardware disabled the channel
+ * @param[in] DMA_channelX DMA Channel
+ * @param[in] context DMA Stream
+ */
+static void DMA_Stream_TE_Callback(DMA_CHANNEL_REG_STRUCT* DMA_channelX, void* context){
+	// Local Variable
+	dma_stream_t* stream = (dma_stream_t *)context;
+	// Stop the Stream
+	stream->errors++;
+	DMA_Stream_Stop(stream);
+}
+
+/**
+ * @brief Starts a circular DMA Stream
+ * @param[in] stream Pointer to the DMA Stream (must stay valid while running)
+ * @returns - `0x00`: Failure (Odd/Zero count/DMA Channel owned by another request/Request not mapped to the channel)
+ * @returns - `0x01`: Success
+ * @note The peripheral DMA request (e.g. `ADC_CR2_DMA`, `USART_CR3_DMAR`) is enabled by the peripheral driver
+ */
+uint8_t DMA_Stream_Start(dma_stream_t* stream){
+	// Local Variable
+	dma_config_t dma_config = {0};
+	// Two non-empty halves
+	if((stream->count < 2) || (stream->count & 0x01) || (stream->buffer == NULL))
+		return 0x00;
+	// Claim the Channel
+	if(!DMA_CH_Allocate(stream->DMA_Channel, stream->request))
+		return 0x00;
+
+	// Reset State
+	stream->overrun = 0x00;
+	stream->errors = 0x00;
+	// Channel Configuration: Circular with Half/Full Interrupts
+	dma_config.DMA_Channel = stream->DMA_Channel;
+	dma_config.channel.direction = stream->direction;
+	dma_config.channel.mem2mem = DMAx_MEM2MEM_DISABLE;
+	dma_config.channel.circular_mode = DMAx_CIRC_ENABLE;
+	dma_config.channel.priority = stream->priority;
+	// Source/Destination are swapped by DMA_Config() for Memory -> Peripheral
+	if(stream->direction == DMAx_DIR_READ_MEM){
+		dma_config.data.srcDataSize = stream->memDataSize;
+		dma_config.data.dstDataSize = stream->perDataSize;
+		dma_config.data.srcInc = DMAx_INC_ENABLE;
+		dma_config.data.dstInc = DMAx_INC_DISABLE;
+	}
+	else{
+		dma_config.data.srcDataSize = stream->perDataSize;
+		dma_config.data.dstDataSize = stream->memDataSize;
+		dma_config.data.srcInc = DMAx_INC_DISABLE;
+		dma_config.data.dstInc = DMAx_INC_ENABLE;
+	}
+	dma_config.interrupt.TCIE = DMAx_IRQ_ENABLE;
+	dma_config.interrupt.HTIE = DMAx_IRQ_ENABLE;
+	dma_config.interrupt.TEIE = DMAx_IRQ_ENABLE;
+	DMA_Config(&dma_config);
+	DMA_CH_clear_flags(stream->DMA_Channel, DMAx_FLAG_ALL);
+	DMA_CH_Register_Callback(stream->DMA_Channel, DMA_Stream_TC_Callback, DMA_Stream_HT_Callback, DMA_Stream_TE_Callback, stream);
+
+	// Buffer
+	if(stream->direction == DMAx_DIR_READ_MEM)
+		DMA_Transfer_Config(stream->DMA_Channel, stream->buffer, (void *)stream->peripheral, stream->count);
+	else
+		DMA_Transfer_Config(stream->DMA_Channel, (void *)stream->peripheral, stream->buffer, stream->count);
+	// Start
+	stream->running = 0x01;
+	DMA_CH_enable(stream->DMA_Channel);
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Stops a DMA Stream and releases its DMA Channel
+ * @param[in] stream Pointer to the DMA Stream
+ */
+void DMA_Stream_Stop(dma_stream_t* stream){
+	// Not running
+	if(!stream->running)
+		return;
+	// Disable the Channel + Free it for other requests
+	DMA_CH_Release(stream->DMA_Channel);
+	stream->running = 0x00;
+}
+
+/**
+ * @brief Retrieves the current position of the DMA in the circular buffer
+ * @param[in] stream Pointer to the DMA Stream
+ * @returns Index of the next item to be transferred (0 - `count - 1`)
+ */
+uint16_t DMA_Stream_Get_Position(dma_stream_t* stream){
+	// Local Variable
+	uint16_t remaining = (uint16_t)stream->DMA_Channel->CNDTR.REG;
+	// CNDTR counts down and reloads to `count` on wrap
+	return (remaining == 0 || remaining >= stream->count) ? 0 : (uint16_t)(stream->count - remaining);
+}
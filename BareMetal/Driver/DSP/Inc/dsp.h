@@ -0,0 +1,215 @@
+// Header Guards
+#ifndef __DSP_H__
+#define __DSP_H__
+
+// Address Mapping & `__SSAT()` (cmsis_gcc.h)
+#include "reg_map.h"
+// State Reset
+#include <string.h>
+// DWT Cycle Counter (Benchmark)
+#include "dwt.h"
+
+/**
+ ** Fixed-Point DSP (Cortex-M3, no FPU):
+ * - Q15 (`q15_t`): 1 sign bit + 15 fractional bits, range [-1, 1)
+ * - Q31 (`q31_t`): 1 sign bit + 31 fractional bits, range [-1, 1)
+ * - Products are accumulated in 64 bits (`(int64_t)a * b + acc` compiles to `SMLAL`) and saturated
+ * 	 with `__SSAT()` (`SSAT`) on the way out: no overflow inside a block
+ * - Every function processes a block (e.g. the half handed over by a DMA Stream callback) and keeps its
+ * 	 history in a state structure, so consecutive blocks form one continuous signal
+ *
+ ** Blocks:
+ * 	 |--- `DSP_ADC_To_Q15()`: 12-bit right aligned ADC results -> Q15 centred on mid scale
+ * 	 |--- `DSP_Oversample()`: sum of 4^n results >> n, n extra effective bits (needs >= 1 LSB of noise)
+ * 	 |--- `DSP_CIC_Process()`: CIC decimator (order 1 = moving average decimator), integer gain removed
+ * 	 |--- `DSP_Biquad_Process()`: cascade of Q31 biquads (Direct Form I), coefficients in [-2^s, 2^s)
+ * 	 |--- `DSP_FIR_Process()`: short Q15 FIR, doubled delay line (no wrap test in the tap loop)
+ *
+ ** Benchmark:
+ * - `DWT_Cycle_Counter_Start()` / `DWT_Cycle_Counter_Get()` (dwt.h) read the DWT cycle counter (CYCCNT)
+ * - Cycles per sample = `DWT_Cycle_Counter_Get()` after one block / number of input samples
+ * - Flash wait states (2 at 72 MHz) count: run from a warm prefetch buffer or RAM for repeatable numbers
+ * - `DSP_Benchmark()` pushes one `DSP_BENCHMARK_BLOCK_SIZE` block through every stage with a fixed setup:
+ * 	 |--- Oversample: `DSP_BENCHMARK_OVERSAMPLE_BITS` extra bits
+ * 	 |--- CIC: order `DSP_BENCHMARK_CIC_ORDER`, decimation 2^`DSP_BENCHMARK_CIC_LOG2_DECIMATION`
+ * 	 |--- Biquad: `DSP_BENCHMARK_BIQUAD_STAGES` Butterworth low pass stages (fc = fs / 8)
+ * 	 |--- FIR: `DSP_BENCHMARK_FIR_TAPS` taps moving average
+ */
+
+// Fractional Types
+typedef int16_t q15_t;
+typedef int32_t q31_t;
+
+// CIC Decimator State
+typedef struct {
+	// Integrators & Combs (modulo 2^32 arithmetic: wrap-around cancels out between the two)
+	uint32_t integrator[DSP_CIC_MAX_ORDER];
+	uint32_t comb[DSP_CIC_MAX_ORDER];
+	// Order (1 - `DSP_CIC_MAX_ORDER`)
+	uint8_t order;
+	// Decimation = 2^log2_decimation
+	uint8_t log2_decimation;
+	// Input samples since the last output
+	uint16_t phase;
+} dsp_cic_t;
+
+// Biquad Cascade (Direct Form I, Q31)
+typedef struct {
+	// Coefficients, 5 per stage {b0, b1, b2, a1, a2} scaled by 2^-post_shift
+	// y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] + a1 y[n-1] + a2 y[n-2] (a1, a2 with the sign already inverted)
+	const q31_t* coeffs;
+	// State, 4 per stage {x[n-1], x[n-2], y[n-1], y[n-2]} (zeroed by `DSP_Biquad_Init()`)
+	q31_t* state;
+	// Number of stages
+	uint8_t stages;
+	// Coefficient Scaling (0: [-1, 1), 1: [-2, 2), ...)
+	uint8_t post_shift;
+} dsp_biquad_t;
+
+// FIR (Q15)
+typedef struct {
+	// Coefficients {h[0], ..., h[taps - 1]}
+	const q15_t* coeffs;
+	// Delay Line, `2 * taps` items (zeroed by `DSP_FIR_Init()`)
+	q15_t* state;
+	// Number of taps
+	uint8_t taps;
+	// Newest sample position in the delay line
+	uint8_t index;
+} dsp_fir_t;
+
+// Benchmark Results: core clock cycles per input sample x `DSP_BENCHMARK_SCALE` (e.g. 1250 = 12.5 cycles)
+typedef struct {
+	uint32_t adc_to_q15;
+	uint32_t oversample;
+	uint32_t cic;
+	// Whole cascade
+	uint32_t biquad;
+	uint32_t fir;
+} dsp_benchmark_t;
+
+/**
+ * @brief Converts a Q31 value to Q15 (rounded, saturated)
+ * @param[in] x Q31 value
+ * @returns Q15 value
+ */
+__STATIC_INLINE__ q15_t DSP_Q31_To_Q15(q31_t x){
+	// Round to nearest, `SSAT` catches the rounding overflow of `0x7FFFxxxx`
+	return (q15_t)__SSAT((int32_t)(((int64_t)x + 0x8000) >> 16), 16);
+}
+
+/**
+ * @brief Converts a Q15 value to Q31
+ * @param[in] x Q15 value
+ * @returns Q31 value
+ */
+__STATIC_INLINE__ q31_t DSP_Q15_To_Q31(q15_t x){
+	// Exact
+	return ((q31_t)x << 16);
+}
+
+/**
+ * @brief Saturates a 64-bit accumulator to Q31
+ * @param[in] acc Accumulator (already shifted to Q31)
+ * @returns Q31 value
+ */
+__STATIC_INLINE__ q31_t DSP_Saturate_Q31(int64_t acc){
+	// `SSAT` stops at 32 bits
+	if(acc > DSP_Q31_MAX)
+		return DSP_Q31_MAX;
+	if(acc < DSP_Q31_MIN)
+		return DSP_Q31_MIN;
+	return (q31_t)acc;
+}
+
+/**
+ * @brief Converts 12-bit right aligned ADC results to Q15
+ * @param[in] in ADC results
+ * @param[out] out Q15 samples (may alias `in`)
+ * @param[in] count Number of samples
+ */
+void DSP_ADC_To_Q15(const uint16_t* in, q15_t* out, uint16_t count);
+
+/**
+ * @brief Oversamples & decimates ADC results for extra effective bits
+ * @param[in] in ADC results (12-bit right aligned)
+ * @param[in] count Number of input samples
+ * @param[in] extra_bits Extra bits n (1 - `DSP_OVERSAMPLE_MAX_BITS`), 4^n inputs per output
+ * @param[out] out Results of `12 + n` bits (`count / 4^n` items)
+ * @returns Number of outputs (a trailing partial group is dropped)
+ */
+uint16_t DSP_Oversample(const uint16_t* in, uint16_t count, uint8_t extra_bits, uint16_t* out);
+
+/**
+ * @brief Initializes a CIC Decimator
+ * @param[in] cic Pointer to the CIC State
+ * @param[in] order Order (1 - `DSP_CIC_MAX_ORDER`), 1: moving average decimator
+ * @param[in] log2_decimation Decimation = 2^log2_decimation (`order * log2_decimation <= DSP_CIC_MAX_GROWTH`)
+ * @returns - `0x00`: Failure (Invalid order/decimation)
+ * @returns - `0x01`: Success
+ */
+uint8_t DSP_CIC_Init(dsp_cic_t* cic, uint8_t order, uint8_t log2_decimation);
+
+/**
+ * @brief Runs a block through the CIC Decimator
+ * @param[in] cic Pointer to the CIC State
+ * @param[in] in Q15 samples
+ * @param[in] count Number of input samples (need not be a multiple of the decimation)
+ * @param[out] out Q15 samples (unity DC gain), at most `count / decimation + 1` items
+ * @returns Number of outputs
+ */
+uint16_t DSP_CIC_Process(dsp_cic_t* cic, const q15_t* in, uint16_t count, q15_t* out);
+
+/**
+ * @brief Initializes a Biquad Cascade
+ * @param[in] biquad Pointer to the Biquad Cascade
+ * @param[in] coeffs Coefficients (5 per stage)
+ * @param[in] state State (4 per stage)
+ * @param[in] stages Number of stages
+ * @param[in] post_shift Coefficient Scaling (0 - 30)
+ * @returns - `0x00`: Failure (No coefficients/state/stages, invalid scaling)
+ * @returns - `0x01`: Success
+ */
+uint8_t DSP_Biquad_Init(dsp_biquad_t* biquad, const q31_t* coeffs, q31_t* state, uint8_t stages, uint8_t post_shift);
+
+/**
+ * @brief Runs a block through the Biquad Cascade
+ * @param[in] biquad Pointer to the Biquad Cascade
+ * @param[in] in Q31 samples
+ * @param[out] out Q31 samples (may alias `in`)
+ * @param[in] count Number of samples
+ */
+void DSP_Biquad_Process(dsp_biquad_t* biquad, const q31_t* in, q31_t* out, uint16_t count);
+
+/**
+ * @brief Initializes a FIR
+ * @param[in] fir Pointer to the FIR
+ * @param[in] coeffs Coefficients (`taps` items)
+ * @param[in] state Delay Line (`2 * taps` items)
+ * @param[in] taps Number of taps (1 - 255)
+ * @returns - `0x00`: Failure (No coefficients/state/taps)
+ * @returns - `0x01`: Success
+ */
+uint8_t DSP_FIR_Init(dsp_fir_t* fir, const q15_t* coeffs, q15_t* state, uint8_t taps);
+
+/**
+ * @brief Runs a block through the FIR
+ * @param[in] fir Pointer to the FIR
+ * @param[in] in Q15 samples
+ * @param[out] out Q15 samples (may alias `in`)
+ * @param[in] count Number of samples
+ */
+void DSP_FIR_Process(dsp_fir_t* fir, const q15_t* in, q15_t* out, uint16_t count);
+
+/**
+ * @brief Measures the cost of every stage on a fixed block (DWT cycle counter)
+ * @param[out] result Cycles per input sample of each stage
+ * @returns - `0x00`: Failure (No result storage)
+ * @returns - `0x01`: Success
+ * @note - Interrupts are masked while a stage runs, the counter read overhead is removed
+ * @note - The chain runs twice (warm prefetch buffer & filter states), the second pass is kept
+ * @note - Blocks live on the stack (~700 bytes): check the stack size before calling
+ */
+uint8_t DSP_Benchmark(dsp_benchmark_t* result);
+
+#endif /* __DSP_H__ */
@@ -0,0 +1,334 @@
+// Header
+#include "dsp.h"
+
+// Benchmark Biquad: Butterworth low pass (fc = fs / 8), {b0, b1, b2, a1, a2} x 2^-1 per stage
+static const q31_t dsp_benchmark_biquad[DSP_BENCHMARK_BIQUAD_STAGES * 5] = {
+	104830566, 209661133, 104830566, 1012333500, -357913941,
+	104830566, 209661133, 104830566, 1012333500, -357913941,
+};
+
+/**
+ * @brief Converts 12-bit right aligned ADC results to Q15
+ * @param[in] in ADC results
+ * @param[out] out Q15 samples (may alias `in`)
+ * @param[in] count Number of samples
+ */
+void DSP_ADC_To_Q15(const uint16_t* in, q15_t* out, uint16_t count){
+	// Centre on mid scale & scale 12 -> 16 bits
+	while(count--)
+		*out++ = (q15_t)(((int32_t)(*in++ & MAX_ADC_VALUE) - DSP_ADC_MID_SCALE) << DSP_ADC_Q15_SHIFT);
+}
+
+/**
+ * @brief Oversamples & decimates ADC results for extra effective bits
+ * @param[in] in ADC results (12-bit right aligned)
+ * @param[in] count Number of input samples
+ * @param[in] extra_bits Extra bits n (1 - `DSP_OVERSAMPLE_MAX_BITS`), 4^n inputs per output
+ * @param[out] out Results of `12 + n` bits (`count / 4^n` items)
+ * @returns Number of outputs (a trailing partial group is dropped)
+ */
+uint16_t DSP_Oversample(const uint16_t* in, uint16_t count, uint8_t extra_bits, uint16_t* out){
+	// Local Variables
+	uint16_t group = 0;
+	uint16_t outputs = 0;
+	uint16_t i = 0;
+	uint32_t sum = 0;
+	// Invalid Oversampling
+	if((extra_bits == 0) || (extra_bits > DSP_OVERSAMPLE_MAX_BITS))
+		return 0;
+	// 4^n inputs per output
+	group = (uint16_t)(1U << (2 * extra_bits));
+	while(count >= group){
+		sum = 0;
+		for(i = 0; i < group; i++)
+			sum += (*in++ & MAX_ADC_VALUE);
+		// Sum has 12 + 2n bits, n of them are noise
+		*out++ = (uint16_t)(sum >> extra_bits);
+		count -= group;
+		outputs++;
+	}
+	// Number of outputs
+	return outputs;
+}
+
+/**
+ * @brief Initializes a CIC Decimator
+ * @param[in] cic Pointer to the CIC State
+ * @param[in] order Order (1 - `DSP_CIC_MAX_ORDER`), 1: moving average decimator
+ * @param[in] log2_decimation Decimation = 2^log2_decimation (`order * log2_decimation <= DSP_CIC_MAX_GROWTH`)
+ * @returns - `0x00`: Failure (Invalid order/decimation)
+ * @returns - `0x01`: Success
+ */
+uint8_t DSP_CIC_Init(dsp_cic_t* cic, uint8_t order, uint8_t log2_decimation){
+	// Invalid Arguments
+	if((cic == NULL) || (order == 0) || (order > DSP_CIC_MAX_ORDER) || (log2_decimation == 0))
+		return 0x00;
+	// Bit growth must fit in the 32-bit registers
+	if((order * log2_decimation) > DSP_CIC_MAX_GROWTH)
+		return 0x00;
+	// Reset State
+	memset(cic, 0, sizeof(dsp_cic_t));
+	cic->order = order;
+	cic->log2_decimation = log2_decimation;
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Runs a block through the CIC Decimator
+ * @param[in] cic Pointer to the CIC State
+ * @param[in] in Q15 samples
+ * @param[in] count Number of input samples (need not be a multiple of the decimation)
+ * @param[out] out Q15 samples (unity DC gain), at most `count / decimation + 1` items
+ * @returns Number of outputs
+ */
+uint16_t DSP_CIC_Process(dsp_cic_t* cic, const q15_t* in, uint16_t count, q15_t* out){
+	// Local Variables
+	uint16_t decimation = (uint16_t)(1U << cic->log2_decimation);
+	uint16_t outputs = 0;
+	uint32_t value = 0;
+	uint32_t previous = 0;
+	uint8_t stage = 0;
+	while(count--){
+		// Integrators (input rate)
+		value = (uint32_t)(int32_t)*in++;
+		for(stage = 0; stage < cic->order; stage++){
+			cic->integrator[stage] += value;
+			value = cic->integrator[stage];
+		}
+		// Decimate
+		if(++cic->phase < decimation)
+			continue;
+		cic->phase = 0;
+		// Combs (output rate)
+		for(stage = 0; stage < cic->order; stage++){
+			previous = cic->comb[stage];
+			cic->comb[stage] = value;
+			value -= previous;
+		}
+		// Remove the gain decimation^order
+		*out++ = (q15_t)__SSAT((int32_t)value >> (cic->order * cic->log2_decimation), 16);
+		outputs++;
+	}
+	// Number of outputs
+	return outputs;
+}
+
+/**
+ * @brief Initializes a Biquad Cascade
+ * @param[in] biquad Pointer to the Biquad Cascade
+ * @param[in] coeffs Coefficients (5 per stage)
+ * @param[in] state State (4 per stage)
+ * @param[in] stages Number of stages
+ * @param[in] post_shift Coefficient Scaling (0 - 30)
+ * @returns - `0x00`: Failure (No coefficients/state/stages, invalid scaling)
+ * @returns - `0x01`: Success
+ */
+uint8_t DSP_Biquad_Init(dsp_biquad_t* biquad, const q31_t* coeffs, q31_t* state, uint8_t stages, uint8_t post_shift){
+	// Invalid Arguments
+	if((biquad == NULL) || (coeffs == NULL) || (state == NULL) || (stages == 0) || (post_shift >= DSP_Q31_SHIFT))
+		return 0x00;
+	// Cascade
+	biquad->coeffs = coeffs;
+	biquad->state = state;
+	biquad->stages = stages;
+	biquad->post_shift = post_shift;
+	// Silence
+	memset(state, 0, (size_t)stages * 4 * sizeof(q31_t));
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Runs a block through the Biquad Cascade
+ * @param[in] biquad Pointer to the Biquad Cascade
+ * @param[in] in Q31 samples
+ * @param[out] out Q31 samples (may alias `in`)
+ * @param[in] count Number of samples
+ */
+void DSP_Biquad_Process(dsp_biquad_t* biquad, const q31_t* in, q31_t* out, uint16_t count){
+	// Local Variables
+	const q31_t* coeffs = biquad->coeffs;
+	q31_t* state = biquad->state;
+	const q31_t* src = in;
+	uint8_t shift = DSP_Q31_SHIFT - biquad->post_shift;
+	uint8_t stage = 0;
+	uint16_t n = 0;
+	int64_t acc = 0;
+	q31_t x = 0;
+	q31_t y = 0;
+	// Stage by stage over the block (coefficients & state stay in registers)
+	for(stage = 0; stage < biquad->stages; stage++){
+		// Coefficients & State of the stage
+		q31_t b0 = coeffs[0], b1 = coeffs[1], b2 = coeffs[2], a1 = coeffs[3], a2 = coeffs[4];
+		q31_t x1 = state[0], x2 = state[1], y1 = state[2], y2 = state[3];
+		for(n = 0; n < count; n++){
+			x = src[n];
+			// 32 x 32 -> 64 multiply-accumulate (SMULL/SMLAL)
+			acc = (int64_t)b0 * x;
+			acc += (int64_t)b1 * x1;
+			acc += (int64_t)b2 * x2;
+			acc += (int64_t)a1 * y1;
+			acc += (int64_t)a2 * y2;
+			// Back to Q31 (undo the coefficient scaling)
+			y = DSP_Saturate_Q31(acc >> shift);
+			// Delay Line
+			x2 = x1;
+			x1 = x;
+			y2 = y1;
+			y1 = y;
+			out[n] = y;
+		}
+		// Save the State
+		state[0] = x1;
+		state[1] = x2;
+		state[2] = y1;
+		state[3] = y2;
+		// Next stage filters the output
+		coeffs += 5;
+		state += 4;
+		src = out;
+	}
+}
+
+/**
+ * @brief Initializes a FIR
+ * @param[in] fir Pointer to the FIR
+ * @param[in] coeffs Coefficients (`taps` items)
+ * @param[in] state Delay Line (`2 * taps` items)
+ * @param[in] taps Number of taps (1 - 255)
+ * @returns - `0x00`: Failure (No coefficients/state/taps)
+ * @returns - `0x01`: Success
+ */
+uint8_t DSP_FIR_Init(dsp_fir_t* fir, const q15_t* coeffs, q15_t* state, uint8_t taps){
+	// Invalid Arguments
+	if((fir == NULL) || (coeffs == NULL) || (state == NULL) || (taps == 0))
+		return 0x00;
+	// Filter
+	fir->coeffs = coeffs;
+	fir->state = state;
+	fir->taps = taps;
+	fir->index = 0;
+	// Silence
+	memset(state, 0, (size_t)taps * 2 * sizeof(q15_t));
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Runs a block through the FIR
+ * @param[in] fir Pointer to the FIR
+ * @param[in] in Q15 samples
+ * @param[out] out Q15 samples (may alias `in`)
+ * @param[in] count Number of samples
+ */
+void DSP_FIR_Process(dsp_fir_t* fir, const q15_t* in, q15_t* out, uint16_t count){
+	// Local Variables
+	const q15_t* coeffs = fir->coeffs;
+	const q15_t* window = NULL;
+	uint8_t taps = fir->taps;
+	uint8_t index = fir->index;
+	uint8_t k = 0;
+	int64_t acc = 0;
+	while(count--){
+		// Newest sample written twice: `state[index + k]` is x[n - k] without wrapping
+		index = ((index == 0) ? taps : index) - 1;
+		fir->state[index] = fir->state[index + taps] = *in++;
+		window = &fir->state[index];
+		// Q15 x Q15 products accumulated in 64 bits (SMLAL)
+		acc = 0;
+		for(k = 0; k < taps; k++)
+			acc += (int64_t)coeffs[k] * window[k];
+		// Round & back to Q15
+		*out++ = (q15_t)__SSAT((int32_t)((acc + (1 << (DSP_Q15_SHIFT - 1))) >> DSP_Q15_SHIFT), 16);
+	}
+	// Save the position
+	fir->index = index;
+}
+
+/**
+ * @brief Converts a measured block into cycles per sample
+ * @param[in] cycles Cycles of the block (counter overhead included)
+ * @param[in] overhead Cycles of an empty measurement
+ * @returns Cycles per input sample x `DSP_BENCHMARK_SCALE` (rounded)
+ */
+__STATIC_INLINE__ uint32_t DSP_Benchmark_Per_Sample(uint32_t cycles, uint32_t overhead){
+	// Remove the counter overhead
+	cycles = (cycles > overhead) ? (cycles - overhead) : 0;
+	// Rounded to nearest
+	return ((cycles * DSP_BENCHMARK_SCALE) + (DSP_BENCHMARK_BLOCK_SIZE / 2)) / DSP_BENCHMARK_BLOCK_SIZE;
+}
+
+/**
+ * @brief Measures the cost of every stage on a fixed block (DWT cycle counter)
+ * @param[out] result Cycles per input sample of each stage
+ * @returns - `0x00`: Failure (No result storage)
+ * @returns - `0x01`: Success
+ * @note - Interrupts are masked while a stage runs, the counter read overhead is removed
+ * @note - The chain runs twice (warm prefetch buffer & filter states), the second pass is kept
+ * @note - Blocks live on the stack (~700 bytes): check the stack size before calling
+ */
+uint8_t DSP_Benchmark(dsp_benchmark_t* result){
+	// Local Variables
+	uint16_t adc[DSP_BENCHMARK_BLOCK_SIZE];
+	q15_t samples[DSP_BENCHMARK_BLOCK_SIZE];
+	q31_t wide[DSP_BENCHMARK_BLOCK_SIZE];
+	uint16_t oversampled[DSP_BENCHMARK_BLOCK_SIZE >> (2 * DSP_BENCHMARK_OVERSAMPLE_BITS)];
+	q15_t decimated[(DSP_BENCHMARK_BLOCK_SIZE >> DSP_BENCHMARK_CIC_LOG2_DECIMATION) + 1];
+	q15_t fir_coeffs[DSP_BENCHMARK_FIR_TAPS];
+	q15_t fir_state[2 * DSP_BENCHMARK_FIR_TAPS];
+	q31_t biquad_state[4 * DSP_BENCHMARK_BIQUAD_STAGES];
+	dsp_cic_t cic;
+	dsp_biquad_t biquad;
+	dsp_fir_t fir;
+	uint32_t primask = 0;
+	uint32_t overhead = 0;
+	uint16_t i = 0;
+	uint8_t pass = 0;
+	// No result storage
+	if(result == NULL)
+		return 0x00;
+
+	// Fixed input: 12-bit sawtooth, FIR: moving average (1 / taps each)
+	for(i = 0; i < DSP_BENCHMARK_BLOCK_SIZE; i++)
+		adc[i] = (uint16_t)((i * 67U) & MAX_ADC_VALUE);
+	for(i = 0; i < DSP_BENCHMARK_FIR_TAPS; i++)
+		fir_coeffs[i] = (q15_t)(DSP_Q15_MAX / DSP_BENCHMARK_FIR_TAPS);
+	DSP_CIC_Init(&cic, DSP_BENCHMARK_CIC_ORDER, DSP_BENCHMARK_CIC_LOG2_DECIMATION);
+	DSP_Biquad_Init(&biquad, dsp_benchmark_biquad, biquad_state, DSP_BENCHMARK_BIQUAD_STAGES, 1);
+	DSP_FIR_Init(&fir, fir_coeffs, fir_state, DSP_BENCHMARK_FIR_TAPS);
+
+	// Measurements must not include interrupts
+	primask = __get_PRIMASK();
+	__disable_irq();
+	// Counter overhead (start + read)
+	DWT_Cycle_Counter_Start();
+	overhead = DWT_Cycle_Counter_Get();
+	for(pass = 0; pass < 2; pass++){
+		// ADC -> Q15
+		DWT_Cycle_Counter_Start();
+		DSP_ADC_To_Q15(adc, samples, DSP_BENCHMARK_BLOCK_SIZE);
+		result->adc_to_q15 = DSP_Benchmark_Per_Sample(DWT_Cycle_Counter_Get(), overhead);
+		// Oversampling
+		DWT_Cycle_Counter_Start();
+		DSP_Oversample(adc, DSP_BENCHMARK_BLOCK_SIZE, DSP_BENCHMARK_OVERSAMPLE_BITS, oversampled);
+		result->oversample = DSP_Benchmark_Per_Sample(DWT_Cycle_Counter_Get(), overhead);
+		// CIC Decimator
+		DWT_Cycle_Counter_Start();
+		DSP_CIC_Process(&cic, samples, DSP_BENCHMARK_BLOCK_SIZE, decimated);
+		result->cic = DSP_Benchmark_Per_Sample(DWT_Cycle_Counter_Get(), overhead);
+		// Biquad Cascade (Q31 input, not timed)
+		for(i = 0; i < DSP_BENCHMARK_BLOCK_SIZE; i++)
+			wide[i] = DSP_Q15_To_Q31(samples[i]);
+		DWT_Cycle_Counter_Start();
+		DSP_Biquad_Process(&biquad, wide, wide, DSP_BENCHMARK_BLOCK_SIZE);
+		result->biquad = DSP_Benchmark_Per_Sample(DWT_Cycle_Counter_Get(), overhead);
+		// FIR (in place: `samples` is rebuilt on the next pass)
+		DWT_Cycle_Counter_Start();
+		DSP_FIR_Process(&fir, samples, samples, DSP_BENCHMARK_BLOCK_SIZE);
+		result->fir = DSP_Benchmark_Per_Sample(DWT_Cycle_Counter_Get(), overhead);
+	}
+	__set_PRIMASK(primask);
+	// Success
+	return 0x01;
+}
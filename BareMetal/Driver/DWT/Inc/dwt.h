@@ -0,0 +1,38 @@
+// Header Guards
+#ifndef __DWT_H__
+#define __DWT_H__
+
+// Address Mapping
+#include "reg_map.h"
+
+/**
+ ** DWT Cycle Counter (Cortex-M3 core, header only):
+ * - CYCCNT counts core clock cycles once trace is enabled (`DEMCR.TRCENA`) and `DWT_CTRL.CYCCNTENA` is set
+ * - Measure: `DWT_Cycle_Counter_Start()`, code under test, `DWT_Cycle_Counter_Get()`
+ * 	 |--- The start/read pair itself costs a few cycles: measure it once & subtract it
+ * 	 |--- Interrupts taken in between are counted, mask them for repeatable numbers
+ * - Wraps after 2^32 cycles (~59 s at 72 MHz)
+ * - A debugger may also use the DWT: starting the counter resets CYCCNT under its feet
+ */
+
+/**
+ * @brief Starts the DWT Cycle Counter from zero
+ */
+__STATIC_INLINE__ void DWT_Cycle_Counter_Start(void){
+	// Trace Enable (DWT access)
+	DWT_DEMCR |= DWT_DEMCR_TRCENA;
+	// Restart the Counter
+	DWT_CYCCNT = 0;
+	DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+}
+
+/**
+ * @brief Retrieves the DWT Cycle Counter
+ * @returns Core clock cycles since `DWT_Cycle_Counter_Start()`
+ */
+__STATIC_INLINE__ uint32_t DWT_Cycle_Counter_Get(void){
+	// Free running, wraps after 2^32 cycles (~59 s at 72 MHz)
+	return DWT_CYCCNT;
+}
+
+#endif /* __DWT_H__ */
@@ -21,6 +21,20 @@
 	I2C_Enable((I2C_CONFIGx)->I2Cx); 	\
 }
 
+// I2C Error Statistics (Master transfers: blocking, DMA address & data phases)
+typedef struct {
+	// Bus Errors
+	uint32_t berr;
+	// Arbitration Lost
+	uint32_t arlo;
+	// Acknowledge Failures (NACK)
+	uint32_t af;
+	// Overrun/Underrun
+	uint32_t ovr;
+	// Timeouts
+	uint32_t timeout;
+} i2c_error_stats_t;
+
 /**
  * @brief I2C Bus Ready
  * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
@@ -69,6 +83,25 @@ __STATIC_INLINE__ uint8_t I2C_readByte(I2C_REG_STRUCT* I2Cx){
 	return byte;
 }
 
+/**
+ * @brief Retrieves the I2C Error Flags
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @returns Any logical combination of `I2Cx_ERR_BERR`, `I2Cx_ERR_ARLO`, `I2Cx_ERR_AF`, `I2Cx_ERR_OVR`
+ */
+__STATIC_INLINE__ uint8_t I2C_Get_Error(I2C_REG_STRUCT* I2Cx){
+	// SR1[11:8]: OVR | AF | ARLO | BERR
+	return (uint8_t)((I2Cx->SR1.REG >> I2C_SR1_BERR_Pos) & 0x0F);
+}
+
+/**
+ * @brief Clears the I2C Error Flags
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ */
+__STATIC_INLINE__ void I2C_Clear_Error(I2C_REG_STRUCT* I2Cx){
+	// Error flags are cleared by writing 0
+	I2Cx->SR1.REG &= ~(I2C_SR1_BERR | I2C_SR1_ARLO | I2C_SR1_AF | I2C_SR1_OVR);
+}
+
 /**
  * @brief I2C Send STOP Sequence
  * @param I2Cx I2C Instance: `I2C1`, `I2C2`
@@ -78,54 +111,93 @@ __STATIC_INLINE__ void I2C_sendStop(I2C_REG_STRUCT* I2Cx){
 	I2Cx->CR1.REG |= I2C_CR1_STOP;
 }
 
+/**
+ * @brief Waits (bounded) for a Status Flag in SR1
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @param[in] flag Any logical combination of `I2C_SR1_xx` flags (first one set ends the wait)
+ * @returns - `I2Cx_ERR_NONE`: Flag set
+ * @returns - `I2Cx_ERR_BERR`/`I2Cx_ERR_ARLO`/`I2Cx_ERR_AF`/`I2Cx_ERR_OVR`: Bus error reported in SR1 (flags are cleared)
+ * @returns - `I2Cx_ERR_TIMEOUT`: Flag not set within `I2Cx_TIMEOUT_US`
+ */
+uint8_t I2C_Wait_Flag(I2C_REG_STRUCT* I2Cx, uint32_t flag);
+
+/**
+ * @brief Retrieves the Error Statistics of I2C
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @returns Pointer to the Error Statistics (updated by `I2C_Wait_Flag()` & the DMA Error IRQ)
+ */
+i2c_error_stats_t* I2C_Get_Error_Stats(I2C_REG_STRUCT* I2Cx);
+
+/**
+ * @brief Counts an error in the Error Statistics
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @param[in] error Any logical combination of `I2Cx_ERR_xx`
+ */
+void I2C_Count_Error(I2C_REG_STRUCT* I2Cx, uint8_t error);
+
+/**
+ * @brief Waits (bounded) until the bus is released (BUSY cleared)
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @returns - `I2Cx_ERR_NONE`: Bus free
+ * @returns - `I2Cx_ERR_TIMEOUT`: Bus still busy after `I2Cx_TIMEOUT_US` (see `I2C_Bus_Recovery()`)
+ */
+uint8_t I2C_Wait_Bus_Ready(I2C_REG_STRUCT* I2Cx);
+
 /**
  * @brief I2C Master Write Start Sequence
  * @param I2Cx I2C Instance: `I2C1`, `I2C2`
  * @param slaveAddress Target I2C Slave Address
+ * @returns `I2Cx_ERR_NONE` on success, otherwise `I2Cx_ERR_xx` (STOP already generated on NACK/Timeout)
  * @note Does not generate STOP condition, use `I2C_sendStop()` after writing data
  */
-void I2C_Master_Write_Start(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress);
+uint8_t I2C_Master_Write_Start(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress);
 
 /**
  * @brief I2C Master Write Start Sequence
  * @param I2Cx I2C Instance: `I2C1`, `I2C2`
  * @param slaveAddress Target I2C Slave Address
  * @param registerAddress Target Register Address
+ * @returns `I2Cx_ERR_NONE` on success, otherwise `I2Cx_ERR_xx` (STOP already generated on NACK/Timeout)
  * @note Does not generate STOP condition, use `I2C_sendStop()` after writing data
  */
-void I2C_Master_Write_Start_Reg(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t registerAddress);
+uint8_t I2C_Master_Write_Start_Reg(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t registerAddress);
 
 /**
  * @brief I2C Master Read Start Sequence
  * @param I2Cx I2C Instance: `I2C1`, `I2C2`
  * @param slaveAddress Target I2C Slave Address
  * @param registerAddress Target Register Address
+ * @returns `I2Cx_ERR_NONE` on success, otherwise `I2Cx_ERR_xx` (STOP already generated on NACK/Timeout)
  * @note Does not generate STOP condition, use `I2C_sendStop()` after reading data
  */
-void I2C_Master_Read_Start(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t registerAddress);
+uint8_t I2C_Master_Read_Start(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t registerAddress);
 
 /**
  * @brief I2C Master Stop Sequence
  * @param I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @returns - `I2Cx_ERR_NONE`: Bus released
+ * @returns - `I2Cx_ERR_TIMEOUT`: Bus still busy after `I2Cx_TIMEOUT_US` (see `I2C_Bus_Recovery()`)
  */
-void I2C_Master_Stop(I2C_REG_STRUCT* I2Cx);
+uint8_t I2C_Master_Stop(I2C_REG_STRUCT* I2Cx);
 
 /**
  * @brief I2C Master Write Buffer Data
  * @param I2Cx I2Cx I2C Instance: `I2C1`, `I2C2`
  * @param buffer Pointer to buffer to be transmitted
  * @param buff_len Length of data in buffer to be transmitted
+ * @returns `I2Cx_ERR_NONE` on success, otherwise `I2Cx_ERR_xx` (STOP already generated on NACK/Timeout)
  */
-void I2C_Master_Write_Data(I2C_REG_STRUCT* I2Cx, uint8_t* buffer, uint16_t buff_len);
+uint8_t I2C_Master_Write_Data(I2C_REG_STRUCT* I2Cx, uint8_t* buffer, uint16_t buff_len);
 
 /**
  * @brief I2C Master Write Byte
  * @param I2Cx I2Cx I2C Instance: `I2C1`, `I2C2`
  * @param data Data to be sent on I2C
+ * @returns `I2Cx_ERR_NONE` on success, otherwise `I2Cx_ERR_xx`
  */
-__STATIC_INLINE__ void I2C_Master_Write_Byte(I2C_REG_STRUCT* I2Cx, uint8_t data){
+__STATIC_INLINE__ uint8_t I2C_Master_Write_Byte(I2C_REG_STRUCT* I2Cx, uint8_t data){
 	// I2C Master Single Byte Sent
-	I2C_Master_Write_Data(I2Cx, &data, 1);
+	return I2C_Master_Write_Data(I2Cx, &data, 1);
 }
 
 /**
@@ -134,8 +206,9 @@ __STATIC_INLINE__ void I2C_Master_Write_Byte(I2C_REG_STRUCT* I2Cx, uint8_t data)
  * @param slave_address MAX30102 Slave Address
  * @param register Register Address
  * @param byte Data to be written
+ * @returns `I2Cx_ERR_NONE` on success, otherwise `I2Cx_ERR_xx`
  */
-void I2C_Write_Reg_Byte(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t registerAddress, uint8_t byte);
+uint8_t I2C_Write_Reg_Byte(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t registerAddress, uint8_t byte);
 
 /**
  * @brief Writes Multiple Consecutive Bytes to Register Address of a given Slave Address
@@ -144,15 +217,16 @@ void I2C_Write_Reg_Byte(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t regi
  * @param registerAddress Starting Register Address
  * @param data Pointer to the data buffer
  * @param len Number of bytes to write
+ * @returns `I2Cx_ERR_NONE` on success, otherwise `I2Cx_ERR_xx`
  */
-void I2C_Write_Reg_Block(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t registerAddress, uint8_t* data, uint8_t len);
+uint8_t I2C_Write_Reg_Block(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t registerAddress, uint8_t* data, uint8_t len);
 
 /**
  * @brief Reads a Single Byte from a Register Address of a given Slave Address
  * @param I2Cx I2C Instance: `I2C1`, `I2C2`
  * @param slaveAddress Slave Address
  * @param registerAddress Register Address to read from
- * @returns The read byte
+ * @returns The read byte (`0x00` if the transaction failed)
  */
 uint8_t I2C_Read_Reg_Byte(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t registerAddress);
 
@@ -163,7 +237,8 @@ uint8_t I2C_Read_Reg_Byte(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t re
  * @param registerAddress Starting Register Address
  * @param data Pointer to the buffer to store the read data
  * @param len Number of bytes to read
+ * @returns `I2Cx_ERR_NONE` on success, otherwise `I2Cx_ERR_xx`
  */
-void I2C_Read_Reg_Block(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t registerAddress, uint8_t* data, uint8_t len);
+uint8_t I2C_Read_Reg_Block(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t registerAddress, uint8_t* data, uint8_t len);
 
 #endif /* __I2C_H__ */
\ No newline at end of file
@@ -0,0 +1,139 @@
+// Header Guards
+#ifndef __I2C_BUS_H__
+#define __I2C_BUS_H__
+
+// Address Mapping
+#include "reg_map.h"
+// DMA backed I2C Master Transfers
+#include "i2c_dma.h"
+// Deadlines (Ticks)
+#include "systick.h"
+// memcpy()
+#include <string.h>
+
+// Forward Declaration
+typedef struct i2c_bus_transaction i2c_bus_transaction_t;
+
+// "I2C_Bus_Callback_t" is now a type representing:
+// "Pointer to any function taking I2C Bus Transaction and returning void"
+typedef void (*I2C_Bus_Callback_t)(i2c_bus_transaction_t* transaction);
+
+// I2C Bus Transaction (storage owned by the client until completion)
+struct i2c_bus_transaction {
+	// Target I2C Slave Address
+	uint8_t slaveAddress;
+	// Register Address (Write: sent before every chunk, Read: starting register)
+	uint8_t registerAddress;
+	// Direction
+	// - `I2Cx_WRITE`
+	// - `I2Cx_READ`
+	uint8_t direction: 1;
+	// Priority
+	// - `I2Cx_BUS_PRIORITY_LOW`
+	// - `I2Cx_BUS_PRIORITY_NORMAL`
+	// - `I2Cx_BUS_PRIORITY_HIGH`
+	uint8_t priority: 2;
+	// Flags
+	// - `I2Cx_BUS_FLAG_NONE`: Same register for every chunk (e.g. SSD1306 data stream)
+	// - `I2Cx_BUS_FLAG_REG_INC`: Register advances by the bytes already written (auto-increment devices)
+	// - `I2Cx_BUS_FLAG_DEADLINE`: `deadline` applies (set by `I2C_Bus_Set_Deadline()`)
+	uint8_t flags;
+	// Status
+	// - `I2Cx_BUS_STATUS_IDLE`
+	// - `I2Cx_BUS_STATUS_PENDING`
+	// - `I2Cx_BUS_STATUS_ACTIVE`
+	// - `I2Cx_BUS_STATUS_DONE`
+	// - `I2Cx_BUS_STATUS_ERROR`
+	// - `I2Cx_BUS_STATUS_EXPIRED`
+	volatile uint8_t status;
+	// Data Buffer (must stay valid until completion)
+	uint8_t* buffer;
+	// Number of bytes
+	uint16_t len;
+	// Number of bytes already transferred (managed by the bus)
+	uint16_t offset;
+	// Absolute SysTick deadline to start the transaction (only with `I2Cx_BUS_FLAG_DEADLINE`, wraps modulo 2^32)
+	uint32_t deadline;
+	// Completion Callback (executed in interrupt context, may be NULL)
+	// - A transaction submitted from the callback is started by the next `I2C_Bus_Process()`
+	I2C_Bus_Callback_t callback;
+	// Submission order (managed by the bus)
+	uint32_t sequence;
+};
+
+/**
+ * @brief Checks whether a transaction has completed (successfully or not)
+ * @param[in] transaction Pointer to the I2C Bus Transaction
+ * @returns - `0x00`: Transaction still queued/active
+ * @returns - `0x01`: Transaction completed
+ */
+__STATIC_INLINE__ uint8_t I2C_Bus_Is_Complete(i2c_bus_transaction_t* transaction){
+	// Completion
+	return (transaction->status >= I2Cx_BUS_STATUS_DONE);
+}
+
+/**
+ * @brief Sets the deadline of a transaction relative to now
+ * @param[in] transaction Pointer to the I2C Bus Transaction
+ * @param[in] ticks SysTick ticks from now to start the transaction (< 2^31)
+ */
+__STATIC_INLINE__ void I2C_Bus_Set_Deadline(i2c_bus_transaction_t* transaction, uint32_t ticks){
+	// Absolute tick (modulo 2^32)
+	transaction->deadline = (uint32_t) SysTick_Get_Ticks() + ticks;
+	transaction->flags |= I2Cx_BUS_FLAG_DEADLINE;
+}
+
+/**
+ * @brief Initialises the Bus Manager of an I2C Instance
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2` (configured & enabled)
+ * @note Takes ownership of the I2C DMA Callbacks (`I2C_DMA_Register_Callback()`)
+ */
+void I2C_Bus_Init(I2C_REG_STRUCT* I2Cx);
+
+/**
+ * @brief Queues a transaction on the I2C Bus
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @param[in] transaction Pointer to the I2C Bus Transaction
+ * @returns - `0x00`: Failure (Queue full/Invalid length/Already queued)
+ * @returns - `0x01`: Success
+ * @note - The highest priority pending transaction is started first, then the earliest deadline, then FIFO
+ * @note - Writes longer than `I2Cx_BUS_CHUNK_SIZE` are split into chunks (each START...STOP), so
+ * 		   higher priority transactions can be inserted between the chunks
+ * @note - Called from thread context an idle bus is started immediately, from interrupt context the
+ * 		   transaction waits for `I2C_Bus_Process()`
+ */
+uint8_t I2C_Bus_Submit(I2C_REG_STRUCT* I2Cx, i2c_bus_transaction_t* transaction);
+
+/**
+ * @brief Removes a pending transaction from the I2C Bus
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @param[in] transaction Pointer to the I2C Bus Transaction
+ * @returns - `0x00`: Failure (Not queued/Currently on the bus)
+ * @returns - `0x01`: Success
+ */
+uint8_t I2C_Bus_Cancel(I2C_REG_STRUCT* I2Cx, i2c_bus_transaction_t* transaction);
+
+/**
+ * @brief Expires overdue transactions & starts the next transaction
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @note Call from the main loop: transfers completed in interrupt context only release the bus,
+ * 		 the next transaction/chunk is started here
+ */
+void I2C_Bus_Process(I2C_REG_STRUCT* I2Cx);
+
+/**
+ * @brief Checks whether the bus waits for `I2C_Bus_Process()` to start the next transaction
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @returns - `0x00`: Nothing to start
+ * @returns - `0x01`: Bus released in interrupt context/Transaction queued from interrupt context
+ */
+uint8_t I2C_Bus_Dispatch_Pending(I2C_REG_STRUCT* I2Cx);
+
+/**
+ * @brief Retrieves the number of queued transactions
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @returns Number of pending/active transactions
+ */
+uint8_t I2C_Bus_Pending(I2C_REG_STRUCT* I2Cx);
+
+#endif /* __I2C_BUS_H__ */
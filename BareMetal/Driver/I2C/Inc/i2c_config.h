@@ -168,12 +168,53 @@ uint8_t I2C_Calc_tRISE(uint8_t i2cMode);
  */
 uint16_t I2C_Calc_CCR(uint8_t i2cMode, uint8_t i2cDuty, uint8_t i2cClockFrequencyMHz);
 
+/**
+ * @brief Calculates the SCL frequency produced by a Configuration Structure
+ * @param[in] I2C_CONFIGx I2C Configuration Structure (`freq_MHz`, `mode`, `duty`, `CCR`)
+ * @returns SCL Frequency (in Hz), `0` for an invalid CCR
+ * @note Ideal value: SCL rise/fall times stretch the real period slightly
+ */
+uint32_t I2C_Get_SCL_Freq(i2c_config_t* I2C_CONFIGx);
+
+/**
+ * @brief Selects the fastest compliant CCR/DUTY/TRISE for a bus speed from the live APB1 Clock
+ * @param[in,out] I2C_CONFIGx I2C Configuration Structure (`freq_MHz`, `mode`, `duty`, `CCR`, `TRISE` are updated)
+ * @param[in] speed_Hz Requested SCL Frequency (in Hz): `I2Cx_SPEED_STD`, `I2Cx_SPEED_FAST` or lower
+ * @returns Achieved SCL Frequency (in Hz), `0` if APB1 cannot clock the I2C in the required mode or the
+ * 			speed needs a CCR above `I2Cx_CCR_MAX` (the configuration is then left untouched)
+ * @note - Achieved SCL never exceeds `speed_Hz` and meets tLOW/tHIGH minimums of the I2C specification
+ * @note - Fast Mode evaluates both DUTY settings and keeps the faster one (DUTY = 0 on a tie)
+ * @note - Slowest SCL = APB1 / (2 * `I2Cx_CCR_MAX`): ~4.4 kHz at 36 MHz, ~977 Hz at 8 MHz
+ * @note - Reference results (SYSCLK -> APB1), checked on the host by `tools/test_i2c_timing.py`:
+ * |--------------|--------|-----------|------|------|-----|-------|----------------|
+ * | SYSCLK (MHz) | APB1   | Requested | Mode | DUTY | CCR | TRISE | Achieved (Hz)  |
+ * |--------------|--------|-----------|------|------|-----|-------|----------------|
+ * |  8 (HSI/HSE) |  8 MHz | 100 kHz   | Sm   |  -   |  40 |   9   | 100000         |
+ * |  8 (HSI/HSE) |  8 MHz | 400 kHz   | Fm   |  0   |   7 |   3   | 380952         |
+ * | 36 (PLL)     | 36 MHz | 100 kHz   | Sm   |  -   | 180 |  37   | 100000         |
+ * | 36 (PLL)     | 36 MHz | 400 kHz   | Fm   |  0   |  30 |  11   | 400000         |
+ * | 72 (PLL)     | 36 MHz | 100 kHz   | Sm   |  -   | 180 |  37   | 100000         |
+ * | 72 (PLL)     | 36 MHz | 400 kHz   | Fm   |  0   |  30 |  11   | 400000         |
+ * |--------------|--------|-----------|------|------|-----|-------|----------------|
+ */
+uint32_t I2C_Timing_Solve(i2c_config_t* I2C_CONFIGx, uint32_t speed_Hz);
+
 /**
  * @brief Configures I2C as per the Configuration Structure
  * @param I2C_CONFIGx I2C Configuration Structure
  */
 void I2C_Config(i2c_config_t* I2C_CONFIGx);
 
+/**
+ * @brief Releases a stuck bus and reinitialises the I2C Module
+ * @param[in] I2C_CONFIGx I2C Configuration Structure (same one passed to `I2C_Config()`)
+ * @returns - `0x00`: Failure (SDA still held LOW by a slave)
+ * @returns - `0x01`: Success
+ * @note - SCL is clocked as an open-drain GPIO (up to `I2Cx_RECOVERY_CLOCKS` pulses) until the slave releases SDA
+ * @note - A STOP condition is then generated manually and the module is reconfigured & enabled
+ */
+uint8_t I2C_Bus_Recovery(i2c_config_t* I2C_CONFIGx);
+
 /**
  * @brief I2C load default values
  * @param I2C_CONFIGx I2C Configuration Structure
@@ -4,6 +4,34 @@
 
 // Address Mapping
 #include "reg_map.h"
+// I2C Master Sequences
+#include "i2c.h"
+// I2C Event Interrupt
+#include "i2c_irq.h"
+// DMA Channel Configuration
+#include "dma.h"
+// Slave Mode Ownership
+#include "i2c_slave.h"
+
+// "I2C_DMA_Callback_t" is now a type representing:
+// "Pointer to any function taking I2C Instance and returning void"
+typedef void (*I2C_DMA_Callback_t)(I2C_REG_STRUCT* I2Cx);
+
+// I2C DMA Transfer Handle
+typedef struct {
+	// Transfer State
+	// - `I2Cx_DMA_STATE_READY`
+	// - `I2Cx_DMA_STATE_BUSY_TX`
+	// - `I2Cx_DMA_STATE_BUSY_TX_BTF`
+	// - `I2Cx_DMA_STATE_BUSY_RX`
+	volatile uint8_t state;
+	// Number of bytes in the current transfer
+	uint16_t len;
+	// Transfer Complete Callback
+	I2C_DMA_Callback_t TC_Callback;
+	// Transfer Error Callback
+	I2C_DMA_Callback_t TE_Callback;
+} i2c_dma_handle_t;
 
 /**
  * @brief Enables I2C DMA Configuration
@@ -23,4 +51,92 @@ __STATIC_INLINE__ void I2C_DMA_disable(I2C_REG_STRUCT* I2Cx){
 	I2Cx->CR2.REG &= ~I2C_CR2_DMAEN;
 }
 
-#endif /* __I2C_DMA_H__ */ 
\ No newline at end of file
+/**
+ * @brief Retrieves the TX DMA Channel of I2C
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @returns `DMA_I2C1_TX` (DMA1 Channel 6), `DMA_I2C2_TX` (DMA1 Channel 4)
+ */
+__STATIC_INLINE__ DMA_CHANNEL_REG_STRUCT* I2C_DMA_Get_TX_Channel(I2C_REG_STRUCT* I2Cx){
+	// I2C1
+	if(I2Cx == I2C1)
+		return DMA_I2C1_TX;
+	// I2C2
+	else
+		return DMA_I2C2_TX;
+}
+
+/**
+ * @brief Retrieves the RX DMA Channel of I2C
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @returns `DMA_I2C1_RX` (DMA1 Channel 7), `DMA_I2C2_RX` (DMA1 Channel 5)
+ */
+__STATIC_INLINE__ DMA_CHANNEL_REG_STRUCT* I2C_DMA_Get_RX_Channel(I2C_REG_STRUCT* I2Cx){
+	// I2C1
+	if(I2Cx == I2C1)
+		return DMA_I2C1_RX;
+	// I2C2
+	else
+		return DMA_I2C2_RX;
+}
+
+/**
+ * @brief Registers the Transfer Complete & Transfer Error Callbacks
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @param[in] TC_Callback Called once the STOP condition of a successful transfer is generated
+ * @param[in] TE_Callback Called when the DMA reports a Transfer Error
+ * @note Callbacks are executed in interrupt context
+ */
+void I2C_DMA_Register_Callback(I2C_REG_STRUCT* I2Cx, I2C_DMA_Callback_t TC_Callback, I2C_DMA_Callback_t TE_Callback);
+
+/**
+ * @brief Retrieves the DMA Transfer State of I2C
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @returns - `0x00`: No transfer in progress
+ * @returns - `0x01`: Transfer in progress
+ */
+uint8_t I2C_DMA_Busy(I2C_REG_STRUCT* I2Cx);
+
+/**
+ * @brief Starts a DMA backed Master Write
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @param[in] slaveAddress Target I2C Slave Address
+ * @param[in] buffer Pointer to buffer to be transmitted (must stay valid until completion)
+ * @param[in] len Number of bytes to be transmitted
+ * @returns - `0x00`: Failure (Transfer in progress/Slave mode active/Bus busy/Invalid length/NACK/Timeout)
+ * @returns - `0x01`: Success (Transfer started)
+ * @note - Address phase is executed by the CPU, data phase by DMA1 Channel 6 (`I2C1`) / Channel 4 (`I2C2`)
+ * @note - STOP is generated from the I2C Event IRQ once BTF is set after the last DMA transfer
+ * @note - The DMA Channel is allocated for the transfer and released on completion
+ */
+uint8_t I2C_Master_Write_DMA(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t* buffer, uint16_t len);
+
+/**
+ * @brief Starts a DMA backed Master Read from a Register Address
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @param[in] slaveAddress Target I2C Slave Address
+ * @param[in] registerAddress Starting Register Address
+ * @param[out] buffer Pointer to buffer to store the received data (must stay valid until completion)
+ * @param[in] len Number of bytes to be received
+ * @returns - `0x00`: Failure (Transfer in progress/Slave mode active/Bus busy/Invalid length/NACK/Timeout)
+ * @returns - `0x01`: Success (Transfer started)
+ * @note - Data phase is executed by DMA1 Channel 7 (`I2C1`) / Channel 5 (`I2C2`), allocated for the transfer
+ * @note - 1 byte: ACK cleared before ADDR is cleared, STOP programmed right after
+ * @note - 2 bytes: ACK cleared & POS set before ADDR is cleared, NACK on the second byte
+ * @note - N bytes: ACK set & LAST set, NACK generated by hardware on the last DMA byte
+ */
+uint8_t I2C_Master_Read_DMA(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t registerAddress, uint8_t* buffer, uint16_t len);
+
+/**
+ * @brief Services the I2C Event Interrupt (BTF after the last DMA transfer)
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ */
+void I2C_DMA_EV_IRQ_Handler(I2C_REG_STRUCT* I2Cx);
+
+/**
+ * @brief Services the I2C Error Interrupt (AF/ARLO/BERR/OVR during the DMA data phase)
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @note Aborts the transfer, releases the bus and calls the Transfer Error Callback
+ */
+void I2C_DMA_ER_IRQ_Handler(I2C_REG_STRUCT* I2Cx);
+
+#endif /* __I2C_DMA_H__ */
@@ -8,6 +8,10 @@
 // Interrupt Configuration
 #include "nvic.h"
 
+// "I2C_IRQ_Handler_t" is now a type representing:
+// "Pointer to any function taking I2C Instance and returning void"
+typedef void (*I2C_IRQ_Handler_t)(I2C_REG_STRUCT* I2Cx);
+
 /**
  * @brief Retrieves I2C Event IRQn
  * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
@@ -58,4 +62,13 @@ void I2C_IRQ_Enable(I2C_REG_STRUCT* I2Cx, uint8_t I2C_IRQ_status);
  */
 void I2C_IRQ_Disable(I2C_REG_STRUCT* I2Cx, uint8_t I2C_IRQ_status);
 
+/**
+ * @brief Registers the Event & Error Interrupt Handlers of an I2C Instance
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @param[in] EV_Handler Called from `I2Cx_EV_IRQHandler()` (may be NULL)
+ * @param[in] ER_Handler Called from `I2Cx_ER_IRQHandler()` (may be NULL)
+ * @note Master DMA transfers and Slave mode register their own handlers
+ */
+void I2C_IRQ_Register_Handler(I2C_REG_STRUCT* I2Cx, I2C_IRQ_Handler_t EV_Handler, I2C_IRQ_Handler_t ER_Handler);
+
 #endif /* __I2C_IRQ_H__ */ 
\ No newline at end of file
@@ -0,0 +1,118 @@
+// Header Guards
+#ifndef __I2C_SLAVE_H__
+#define __I2C_SLAVE_H__
+
+// Address Mapping
+#include "reg_map.h"
+// I2C Configuration & Status Helpers
+#include "i2c.h"
+// I2C Interrupts
+#include "i2c_irq.h"
+// Mailbox Queues
+#include "ring_buffer.h"
+
+/**
+ ** Slave Protocol (as seen by the host):
+ * - Write: [ADDR+W] [REG] [DATA0] [DATA1] ... -> `Write_Callback(REG, DATA0)`, `Write_Callback(REG+1, DATA1)`, ...
+ * - Read:  [ADDR+W] [REG] [Sr] [ADDR+R] [DATA0] ... <- `Read_Callback(REG)`, `Read_Callback(REG+1)`, ...
+ * 	 |--- DR is preloaded one byte ahead: the register after the last one received by the host is also
+ * 	 	  read (then NACKed & read again by the next host read), `Read_Callback` must have no side effect
+ * 	 	  (FIFO pop, clear on read): use the mailbox for consumable data, it only consumes acknowledged bytes
+ * - `mailbox` register does not auto-increment:
+ * 	 |--- Writes are queued into `rx` (streaming host -> slave)
+ * 	 |--- Reads are drained from `tx` (streaming slave -> host), `I2Cx_SLAVE_IDLE_BYTE` once empty
+ * - General Call data bytes are queued into `rx` as is
+ */
+
+// "I2C_Slave_Read_Callback_t" is now a type representing:
+// "Pointer to any function taking Register Address and returning the Register Value"
+// Called one byte ahead of the host: it may run for a byte that is never acknowledged, keep it free of side effects
+typedef uint8_t (*I2C_Slave_Read_Callback_t)(uint8_t registerAddress);
+
+// "I2C_Slave_Write_Callback_t" is now a type representing:
+// "Pointer to any function taking Register Address, Register Value and returning void"
+typedef void (*I2C_Slave_Write_Callback_t)(uint8_t registerAddress, uint8_t value);
+
+// "I2C_Slave_Stop_Callback_t" is now a type representing:
+// "Pointer to any function taking the Transfer Direction (`I2Cx_WRITE`/`I2Cx_READ`) and returning void"
+typedef void (*I2C_Slave_Stop_Callback_t)(uint8_t direction);
+
+// I2C Slave Structure
+typedef struct {
+	// I2C Configuration (GPIO + Timing)
+	i2c_config_t i2c_config;
+	// Own 7-bit Address
+	uint8_t ownAddress;
+	// General Call
+	// - `I2Cx_GENCALL_DISABLE`
+	// - `I2Cx_GENCALL_ENABLE`
+	uint8_t generalCall: 1;
+	// Mailbox Register Address (`I2Cx_SLAVE_MAILBOX_REG`)
+	uint8_t mailbox;
+	// Host -> Slave Queue (Mailbox/General Call)
+	ring_buffer_t* rx;
+	// Slave -> Host Queue (Mailbox)
+	ring_buffer_t* tx;
+	// Register Read (executed in interrupt context, must be short at 400kHz)
+	I2C_Slave_Read_Callback_t Read_Callback;
+	// Register Write (executed in interrupt context, must be short at 400kHz)
+	I2C_Slave_Write_Callback_t Write_Callback;
+	// End of Transaction (STOP/NACK), may be NULL
+	I2C_Slave_Stop_Callback_t Stop_Callback;
+
+	// Internal State (managed by the driver)
+	// Register Pointer
+	volatile uint8_t reg;
+	// Next received byte is the Register Address
+	volatile uint8_t expect_reg: 1;
+	// Current transfer addressed through General Call
+	volatile uint8_t gencall: 1;
+	// Current transfer direction
+	volatile uint8_t direction: 1;
+	// Bytes written to DR during the current host read (Mailbox: queued bytes only, the last one is NACKed by the host)
+	volatile uint16_t tx_inflight;
+	// Mailbox: the last byte written to DR was peeked from `tx` (not an idle byte)
+	volatile uint8_t tx_last_from_queue: 1;
+	// Mailbox bytes dropped because `rx` was full
+	volatile uint32_t rx_overrun;
+} i2c_slave_t;
+
+/**
+ * @brief Configures the I2C Instance as an Interrupt driven Slave
+ * @param[in] slave Pointer to the I2C Slave Structure (must stay valid while in slave mode)
+ * @returns - `0x00`: Failure (Invalid address/Instance busy)
+ * @returns - `0x01`: Success
+ * @note - Event, Buffer & Error Interrupts are enabled, clock stretching is kept as a safety net
+ * @note - At 400kHz a byte lasts ~22.5us: callbacks must return well within that to avoid stretching
+ */
+uint8_t I2C_Slave_Init(i2c_slave_t* slave);
+
+/**
+ * @brief Releases the I2C Instance from Slave Mode
+ * @param[in] slave Pointer to the I2C Slave Structure
+ */
+void I2C_Slave_DeInit(i2c_slave_t* slave);
+
+/**
+ * @brief Checks whether an I2C Instance is in Slave Mode
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @returns - `0x00`: Not in slave mode
+ * @returns - `0x01`: Slave registered (`I2C_Slave_Init()` without `I2C_Slave_DeInit()`)
+ */
+uint8_t I2C_Slave_Is_Active(I2C_REG_STRUCT* I2Cx);
+
+/**
+ * @brief Services the I2C Event Interrupt in Slave Mode (ADDR/RXNE/TXE/STOPF)
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ */
+void I2C_Slave_EV_IRQ_Handler(I2C_REG_STRUCT* I2Cx);
+
+/**
+ * @brief Services the I2C Error Interrupt in Slave Mode (AF/BERR/OVR)
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @note AF marks the end of a host read: the byte preloaded in DR is not consumed from `tx`
+ * 		 and the Register Pointer is moved back onto it
+ */
+void I2C_Slave_ER_IRQ_Handler(I2C_REG_STRUCT* I2Cx);
+
+#endif /* __I2C_SLAVE_H__ */
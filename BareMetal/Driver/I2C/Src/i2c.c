@@ -4,29 +4,119 @@
 // Static Variable for Memory Efficiency
 static uint32_t temp = 0x00;
 
+// Error Statistics: `I2C1`, `I2C2`
+static i2c_error_stats_t i2c_error_stats[2] = {0};
+
+/**
+ * @brief Counts an error in the Error Statistics
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @param[in] error Any logical combination of `I2Cx_ERR_xx`
+ */
+void I2C_Count_Error(I2C_REG_STRUCT* I2Cx, uint8_t error){
+	// Local Variable
+	i2c_error_stats_t* stats = I2C_Get_Error_Stats(I2Cx);
+	// One counter per flag
+	if(error & I2Cx_ERR_BERR)
+		stats->berr++;
+	if(error & I2Cx_ERR_ARLO)
+		stats->arlo++;
+	if(error & I2Cx_ERR_AF)
+		stats->af++;
+	if(error & I2Cx_ERR_OVR)
+		stats->ovr++;
+	if(error & I2Cx_ERR_TIMEOUT)
+		stats->timeout++;
+}
+
+/**
+ * @brief Terminates a failed Master transaction
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @param[in] error Error Code returned by `I2C_Wait_Flag()`
+ * @returns `error`
+ * @note STOP is generated on NACK/Timeout, on BERR/ARLO the interface already left Master mode
+ */
+static uint8_t I2C_Master_Abort(I2C_REG_STRUCT* I2Cx, uint8_t error){
+	// Release the bus
+	if(error & (I2Cx_ERR_AF | I2Cx_ERR_TIMEOUT))
+		I2C_sendStop(I2Cx);
+	// Clear the Error Flags
+	I2C_Clear_Error(I2Cx);
+	// Return the Error Code
+	return error;
+}
+
+/**
+ * @brief Waits (bounded) for a Status Flag in SR1
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @param[in] flag Any logical combination of `I2C_SR1_xx` flags (first one set ends the wait)
+ * @returns - `I2Cx_ERR_NONE`: Flag set
+ * @returns - `I2Cx_ERR_BERR`/`I2Cx_ERR_ARLO`/`I2Cx_ERR_AF`/`I2Cx_ERR_OVR`: Bus error reported in SR1 (flags are cleared)
+ * @returns - `I2Cx_ERR_TIMEOUT`: Flag not set within `I2Cx_TIMEOUT_US`
+ */
+uint8_t I2C_Wait_Flag(I2C_REG_STRUCT* I2Cx, uint32_t flag){
+	// Polling budget: core cycles in `I2Cx_TIMEOUT_US` / cycles per iteration
+	uint32_t timeout = ((RCC_Get_CoreClock() / FREQ_1MHz) * I2Cx_TIMEOUT_US) / I2Cx_POLL_CYCLES;
+	// Local Variable
+	uint8_t error = I2Cx_ERR_NONE;
+	// Wait for the flag
+	while(!(I2Cx->SR1.REG & flag)){
+		// Bus Error/Arbitration Lost/Acknowledge Failure/Overrun
+		error = I2C_Get_Error(I2Cx);
+		if(error != I2Cx_ERR_NONE){
+			I2C_Clear_Error(I2Cx);
+			I2C_Count_Error(I2Cx, error);
+			return error;
+		}
+		// Timeout
+		if(timeout-- == 0){
+			I2C_Count_Error(I2Cx, I2Cx_ERR_TIMEOUT);
+			return I2Cx_ERR_TIMEOUT;
+		}
+	}
+	// Flag set
+	return I2Cx_ERR_NONE;
+}
+
+/**
+ * @brief Retrieves the Error Statistics of I2C
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @returns Pointer to the Error Statistics (updated by `I2C_Wait_Flag()` & the DMA Error IRQ)
+ */
+i2c_error_stats_t* I2C_Get_Error_Stats(I2C_REG_STRUCT* I2Cx){
+	// I2C1/I2C2
+	return &i2c_error_stats[(I2Cx == I2C1) ? 0 : 1];
+}
+
 /**
  * @brief I2C Master Write Start Sequence
  * @param I2Cx I2C Instance: `I2C1`, `I2C2`
  * @param slaveAddress Target I2C Slave Address
+ * @returns `I2Cx_ERR_NONE` on success, otherwise `I2Cx_ERR_xx` (STOP already generated on NACK/Timeout)
  * @note Does not generate STOP condition, use `I2C_sendStop()` after writing data
  */
-void I2C_Master_Write_Start(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress){
+uint8_t I2C_Master_Write_Start(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress){
 	// Local Variable
+	uint8_t error = I2Cx_ERR_NONE;
 	temp = 0x00;
 	// Start Sequence
 	I2C_sendStart(I2Cx);
 	// Wait for Start condition (EV5)
-	while(!(I2Cx->SR1.REG & I2C_SR1_SB));
+	if((error = I2C_Wait_Flag(I2Cx, I2C_SR1_SB)) != I2Cx_ERR_NONE)
+		return I2C_Master_Abort(I2Cx, error);
 	// Send Slave Address with Write Privilege
 	I2C_writeAddress(I2Cx, slaveAddress);
-	// Wait for ADDR flag (EV6)
-	while(!(I2Cx->SR1.REG & I2C_SR1_ADDR));
+	// Wait for ADDR flag (EV6), NACK reported as AF
+	if((error = I2C_Wait_Flag(I2Cx, I2C_SR1_ADDR)) != I2Cx_ERR_NONE)
+		return I2C_Master_Abort(I2Cx, error);
 	// Clear ADDR flag by reading SR1
 	temp = I2Cx->SR1.REG;
 	// Clear ADDR flag by reading SR2
 	temp = I2Cx->SR2.REG;
 	// Wait for TXE flag (EV8_1)
-	while(!(I2Cx->SR1.REG & I2C_SR1_TXE));
+	if((error = I2C_Wait_Flag(I2Cx, I2C_SR1_TXE)) != I2Cx_ERR_NONE)
+		return I2C_Master_Abort(I2Cx, error);
+	// Success
+	return I2Cx_ERR_NONE;
 }
 
 /**
@@ -34,17 +124,24 @@ void I2C_Master_Write_Start(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress){
  * @param I2Cx I2C Instance: `I2C1`, `I2C2`
  * @param slaveAddress Target I2C Slave Address
  * @param registerAddress Target Register Address
+ * @returns `I2Cx_ERR_NONE` on success, otherwise `I2Cx_ERR_xx` (STOP already generated on NACK/Timeout)
  * @note Does not generate STOP condition, use `I2C_sendStop()` after writing data
  */
-void I2C_Master_Write_Start_Reg(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t registerAddress){
+uint8_t I2C_Master_Write_Start_Reg(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t registerAddress){
+	// Local Variable
+	uint8_t error = I2Cx_ERR_NONE;
 	// Start Sequence
-	I2C_Master_Write_Start(I2Cx, slaveAddress);
+	if((error = I2C_Master_Write_Start(I2Cx, slaveAddress)) != I2Cx_ERR_NONE)
+		return error;
 	// Write Register Address
 	I2C_writeByte(I2Cx, registerAddress);
 	// Wait for TXE and BTF flags (EV8_2)
-	while(!(I2Cx->SR1.REG & (I2C_SR1_TXE | I2C_SR1_BTF)));
+	if((error = I2C_Wait_Flag(I2Cx, (I2C_SR1_TXE | I2C_SR1_BTF))) != I2Cx_ERR_NONE)
+		return I2C_Master_Abort(I2Cx, error);
 	// Clearing BTF
 	temp = I2Cx->SR1.REG;
+	// Success
+	return I2Cx_ERR_NONE;
 }
 
 /**
@@ -52,38 +149,64 @@ void I2C_Master_Write_Start_Reg(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint
  * @param I2Cx I2C Instance: `I2C1`, `I2C2`
  * @param slaveAddress Target I2C Slave Address
  * @param registerAddress Target Register Address
+ * @returns `I2Cx_ERR_NONE` on success, otherwise `I2Cx_ERR_xx` (STOP already generated on NACK/Timeout)
  * @note Does not generate STOP condition, use `I2C_sendStop()` after reading data
  */
-void I2C_Master_Read_Start(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t registerAddress){
+uint8_t I2C_Master_Read_Start(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t registerAddress){
 	// Local Variable
+	uint8_t error = I2Cx_ERR_NONE;
 	temp = 0x00;
 	// I2C Master Write Start Sequence
-	I2C_Master_Write_Start_Reg(I2Cx, slaveAddress, registerAddress);
+	if((error = I2C_Master_Write_Start_Reg(I2Cx, slaveAddress, registerAddress)) != I2Cx_ERR_NONE)
+		return error;
 	// Repeated START Condition (Switch to Read Mode)
 	I2C_sendStart(I2Cx);
 	// Wait for Start condition (EV5)
-	while (!(I2Cx->SR1.REG & I2C_SR1_SB));
+	if((error = I2C_Wait_Flag(I2Cx, I2C_SR1_SB)) != I2Cx_ERR_NONE)
+		return I2C_Master_Abort(I2Cx, error);
 	// Send Slave Address with Read Privilege
 	I2C_readAddress(I2Cx, slaveAddress);
-	// Send Slave Address with Write Privilege
-	I2C_readAddress(I2Cx, slaveAddress);
 	// Wait for ADDR flag (EV6)
-	while(!(I2Cx->SR1.REG & I2C_SR1_ADDR));
+	if((error = I2C_Wait_Flag(I2Cx, I2C_SR1_ADDR)) != I2Cx_ERR_NONE)
+		return I2C_Master_Abort(I2Cx, error);
 	// Clear ADDR flag by reading SR1
 	temp = I2Cx->SR1.REG;
 	// Clear ADDR flag by reading SR2
 	temp = I2Cx->SR2.REG;
+	// Success
+	return I2Cx_ERR_NONE;
+}
+
+/**
+ * @brief Waits (bounded) until the bus is released (BUSY cleared)
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @returns - `I2Cx_ERR_NONE`: Bus free
+ * @returns - `I2Cx_ERR_TIMEOUT`: Bus still busy after `I2Cx_TIMEOUT_US` (see `I2C_Bus_Recovery()`)
+ */
+uint8_t I2C_Wait_Bus_Ready(I2C_REG_STRUCT* I2Cx){
+	// Polling budget: core cycles in `I2Cx_TIMEOUT_US` / cycles per iteration
+	uint32_t timeout = ((RCC_Get_CoreClock() / FREQ_1MHz) * I2Cx_TIMEOUT_US) / I2Cx_POLL_CYCLES;
+	// Wait until the bus is free
+	while(!(I2C_busReady(I2Cx))){
+		// Timeout
+		if(timeout-- == 0)
+			return I2Cx_ERR_TIMEOUT;
+	}
+	// Success
+	return I2Cx_ERR_NONE;
 }
 
 /**
  * @brief I2C Master Stop Sequence
  * @param I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @returns - `I2Cx_ERR_NONE`: Bus released
+ * @returns - `I2Cx_ERR_TIMEOUT`: Bus still busy after `I2Cx_TIMEOUT_US` (see `I2C_Bus_Recovery()`)
  */
-void I2C_Master_Stop(I2C_REG_STRUCT* I2Cx){
+uint8_t I2C_Master_Stop(I2C_REG_STRUCT* I2Cx){
 	// Generate STOP condition
 	I2C_sendStop(I2Cx);
 	// Wait until STOP condition is generated
-	while(!(I2C_busReady(I2Cx)));
+	return I2C_Wait_Bus_Ready(I2Cx);
 }
 
 /**
@@ -91,15 +214,21 @@ void I2C_Master_Stop(I2C_REG_STRUCT* I2Cx){
  * @param I2Cx I2Cx I2C Instance: `I2C1`, `I2C2`
  * @param buffer Pointer to buffer to be transmitted
  * @param buff_len Length of data in buffer to be transmitted
+ * @returns `I2Cx_ERR_NONE` on success, otherwise `I2Cx_ERR_xx` (STOP already generated on NACK/Timeout)
  */
-void I2C_Master_Write_Data(I2C_REG_STRUCT* I2Cx, uint8_t* buffer, uint16_t buff_len){
+uint8_t I2C_Master_Write_Data(I2C_REG_STRUCT* I2Cx, uint8_t* buffer, uint16_t buff_len){
+	// Local Variable
+	uint8_t error = I2Cx_ERR_NONE;
 	// Write Multiple Bytes
-	for (uint8_t i = 0; i < buff_len; i++) {
+	for (uint16_t i = 0; i < buff_len; i++) {
 		// Write Data Byte
 		I2C_writeByte(I2Cx, buffer[i]);
 		// Wait for TXE and BTF flags (EV8_2)
-		while(!(I2Cx->SR1.REG & (I2C_SR1_TXE | I2C_SR1_BTF)));
+		if((error = I2C_Wait_Flag(I2Cx, (I2C_SR1_TXE | I2C_SR1_BTF))) != I2Cx_ERR_NONE)
+			return I2C_Master_Abort(I2Cx, error);
 	}
+	// Success
+	return I2Cx_ERR_NONE;
 }
 
 /**
@@ -108,16 +237,19 @@ void I2C_Master_Write_Data(I2C_REG_STRUCT* I2Cx, uint8_t* buffer, uint16_t buff_
  * @param[in] slave_address MAX30102 Slave Address
  * @param[in] register Register Address
  * @param[in] byte Data to be written
+ * @returns `I2Cx_ERR_NONE` on success, otherwise `I2Cx_ERR_xx`
  */
-void I2C_Write_Reg_Byte(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t registerAddress, uint8_t byte){
+uint8_t I2C_Write_Reg_Byte(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t registerAddress, uint8_t byte){
+	// Local Variable
+	uint8_t error = I2Cx_ERR_NONE;
 	// I2C Master Write Start Sequence
-	I2C_Master_Write_Start_Reg(I2Cx, slaveAddress, registerAddress);
+	if((error = I2C_Master_Write_Start_Reg(I2Cx, slaveAddress, registerAddress)) != I2Cx_ERR_NONE)
+		return error;
 	// Write Data Byte
-	I2C_writeByte(I2Cx, byte);
-	// Wait for TXE and BTF flags (EV8_2)
-	while(!(I2Cx->SR1.REG & (I2C_SR1_TXE | I2C_SR1_BTF)));
+	if((error = I2C_Master_Write_Data(I2Cx, &byte, 1)) != I2Cx_ERR_NONE)
+		return error;
 	// I2C Master Stop Sequence
-	I2C_Master_Stop(I2Cx);
+	return I2C_Master_Stop(I2Cx);
 }
 
 /**
@@ -127,19 +259,19 @@ void I2C_Write_Reg_Byte(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t regi
  * @param[in] registerAddress Starting Register Address
  * @param[in] data Pointer to the data buffer
  * @param[in] len Number of bytes to write
+ * @returns `I2Cx_ERR_NONE` on success, otherwise `I2Cx_ERR_xx`
  */
-void I2C_Write_Reg_Block(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t registerAddress, uint8_t* data, uint8_t len){
+uint8_t I2C_Write_Reg_Block(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t registerAddress, uint8_t* data, uint8_t len){
+	// Local Variable
+	uint8_t error = I2Cx_ERR_NONE;
 	// I2C Master Write Start Sequence
-	I2C_Master_Write_Start_Reg(I2Cx, slaveAddress, registerAddress);
+	if((error = I2C_Master_Write_Start_Reg(I2Cx, slaveAddress, registerAddress)) != I2Cx_ERR_NONE)
+		return error;
 	// Write Multiple Bytes
-	for (uint8_t i = 0; i < len; i++) {
-		// Write Data Byte
-		I2C_writeByte(I2Cx, data[i]);
-		// Wait for TXE and BTF flags (EV8_2)
-		while(!(I2Cx->SR1.REG & (I2C_SR1_TXE | I2C_SR1_BTF)));
-	}
+	if((error = I2C_Master_Write_Data(I2Cx, data, len)) != I2Cx_ERR_NONE)
+		return error;
 	// I2C Master Stop Sequence
-	I2C_Master_Stop(I2Cx);
+	return I2C_Master_Stop(I2Cx);
 }
 
 /**
@@ -147,19 +279,13 @@ void I2C_Write_Reg_Block(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t reg
  * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
  * @param[in] slaveAddress Slave Address
  * @param[in] registerAddress Register Address to read from
- * @returns The read byte
+ * @returns The read byte (`0x00` if the transaction failed)
  */
 uint8_t I2C_Read_Reg_Byte(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t registerAddress){
 	// Local Variable
 	uint8_t data = 0x00;
-	// I2C Master Read Start Sequence
-	I2C_Master_Read_Start(I2Cx, slaveAddress, registerAddress);
-	// Wait for RXNE flag (EV7)
-	while (!(I2Cx->SR1.REG & I2C_SR1_RXNE));
-	// Read Data Byte
-	data = I2Cx->DR.REG;
-	// I2C Master Stop Sequence
-	I2C_Master_Stop(I2Cx);
+	// I2C Master Read Block (Single Byte)
+	I2C_Read_Reg_Block(I2Cx, slaveAddress, registerAddress, &data, 1);
 	// Return the read byte
 	return data;
 }
@@ -171,10 +297,14 @@ uint8_t I2C_Read_Reg_Byte(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t re
  * @param[in] registerAddress Starting Register Address
  * @param[out] data Pointer to the buffer to store the read data
  * @param[in] len Number of bytes to read
+ * @returns `I2Cx_ERR_NONE` on success, otherwise `I2Cx_ERR_xx`
  */
-void I2C_Read_Reg_Block(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t registerAddress, uint8_t* data, uint8_t len){
+uint8_t I2C_Read_Reg_Block(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t registerAddress, uint8_t* data, uint8_t len){
+	// Local Variable
+	uint8_t error = I2Cx_ERR_NONE;
 	// I2C Master Read Start Sequence
-	I2C_Master_Read_Start(I2Cx, slaveAddress, registerAddress);
+	if((error = I2C_Master_Read_Start(I2Cx, slaveAddress, registerAddress)) != I2Cx_ERR_NONE)
+		return error;
 	// For other bytes, generate ACK
 	I2Cx->CR1.REG |= I2C_CR1_ACK;
 	// Read Multiple Bytes
@@ -183,10 +313,11 @@ void I2C_Read_Reg_Block(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t regi
 		if (i == (len - 1))
 			I2Cx->CR1.REG &= ~I2C_CR1_ACK;
 		// Wait for RXNE flag (EV7)
-		while (!(I2Cx->SR1.REG & I2C_SR1_RXNE));
+		if((error = I2C_Wait_Flag(I2Cx, I2C_SR1_RXNE)) != I2Cx_ERR_NONE)
+			return I2C_Master_Abort(I2Cx, error);
 		// Read Data Byte
 		data[i] = I2Cx->DR.REG;
 	}
 	// I2C Master Stop Sequence
-	I2C_Master_Stop(I2Cx);
+	return I2C_Master_Stop(I2Cx);
 }
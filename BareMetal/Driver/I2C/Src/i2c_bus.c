@@ -0,0 +1,378 @@
+// Header
+#include "i2c_bus.h"
+
+// I2C Bus Manager
+typedef struct {
+	// Queued Transactions (unordered, selection by priority/deadline/sequence)
+	i2c_bus_transaction_t* queue[I2Cx_BUS_QUEUE_SIZE];
+	// Number of queued transactions
+	uint8_t count;
+	// Transaction currently on the bus
+	i2c_bus_transaction_t* volatile active;
+	// Bus released in interrupt context, next transaction to be started by `I2C_Bus_Process()`
+	volatile uint8_t dispatch;
+	// Bytes of the active transaction in flight
+	uint16_t chunk;
+	// Submission counter
+	uint32_t sequence;
+	// Write staging buffer: Register Address + Chunk
+	uint8_t tx[1 + I2Cx_BUS_CHUNK_SIZE];
+} i2c_bus_t;
+
+// I2C Bus Managers: [0] -> `I2C1`, [1] -> `I2C2`
+static i2c_bus_t i2c_bus[2] = {0};
+
+/**
+ * @brief Retrieves the Bus Manager of I2C
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @returns Pointer to the Bus Manager
+ */
+__STATIC_INLINE__ i2c_bus_t* I2C_Bus_Get(I2C_REG_STRUCT* I2Cx){
+	// I2C1: Index 0, I2C2: Index 1
+	return &i2c_bus[(I2Cx == I2C1) ? 0 : 1];
+}
+
+/**
+ * @brief Checks whether a transaction missed its deadline
+ * @param[in] transaction Pointer to the I2C Bus Transaction
+ * @param[in] now Current SysTick tick (truncated to 32 bits)
+ * @returns - `0x00`: No deadline/Deadline not reached
+ * @returns - `0x01`: Deadline passed
+ */
+__STATIC_INLINE__ uint8_t I2C_Bus_Expired(i2c_bus_transaction_t* transaction, uint32_t now){
+	// Signed difference: valid across the 32-bit tick wrap
+	return ((transaction->flags & I2Cx_BUS_FLAG_DEADLINE) && ((int32_t)(now - transaction->deadline) > 0));
+}
+
+/**
+ * @brief Compares the scheduling order of two transactions
+ * @param[in] a Candidate Transaction
+ * @param[in] b Current best Transaction
+ * @returns - `0x00`: `b` goes first
+ * @returns - `0x01`: `a` goes first
+ */
+static uint8_t I2C_Bus_Before(i2c_bus_transaction_t* a, i2c_bus_transaction_t* b){
+	// Priority
+	if(a->priority != b->priority)
+		return (a->priority > b->priority);
+	// Deadline (none is the latest)
+	if((a->flags ^ b->flags) & I2Cx_BUS_FLAG_DEADLINE)
+		return ((a->flags & I2Cx_BUS_FLAG_DEADLINE) != 0);
+	// Earliest deadline (signed difference: valid across the 32-bit tick wrap)
+	if((a->flags & I2Cx_BUS_FLAG_DEADLINE) && (a->deadline != b->deadline))
+		return ((int32_t)(a->deadline - b->deadline) < 0);
+	// Submission Order (wrap-safe like the deadline)
+	return ((int32_t)(a->sequence - b->sequence) < 0);
+}
+
+/**
+ * @brief Removes a transaction from the queue
+ * @param[in] bus Pointer to the Bus Manager
+ * @param[in] index Queue Index
+ * @note Must be called with interrupts disabled
+ */
+static void I2C_Bus_Remove(i2c_bus_t* bus, uint8_t index){
+	// Replace with the last entry (queue is unordered)
+	bus->queue[index] = bus->queue[--bus->count];
+	bus->queue[bus->count] = NULL;
+}
+
+/**
+ * @brief Completes a transaction and hands it back to the client
+ * @param[in] transaction Pointer to the I2C Bus Transaction (already removed from the queue)
+ * @param[in] status `I2Cx_BUS_STATUS_DONE`, `I2Cx_BUS_STATUS_ERROR`, `I2Cx_BUS_STATUS_EXPIRED`
+ */
+static void I2C_Bus_Complete(i2c_bus_transaction_t* transaction, uint8_t status){
+	// Update Status
+	transaction->status = status;
+	// Client Callback
+	if(transaction->callback != NULL)
+		transaction->callback(transaction);
+}
+
+/**
+ * @brief Starts the next transaction if the bus is idle
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @note Thread context only: waits for the bus & polls the address phase (up to `I2Cx_TIMEOUT_US` each)
+ */
+static void I2C_Bus_Dispatch(I2C_REG_STRUCT* I2Cx){
+	// Local Variables
+	i2c_bus_t* bus = I2C_Bus_Get(I2Cx);
+	i2c_bus_transaction_t* next = NULL;
+	uint32_t now = 0x00;
+	uint8_t index = 0x00;
+	uint8_t started = 0x00;
+
+	// Dispatch request served
+	bus->dispatch = 0x00;
+	// Until a transfer is started or nothing is left
+	while(!started){
+		// Disable Global Interrupt
+		__disable_irq();
+		// Bus already owned/Nothing to do
+		if((bus->active != NULL) || (bus->count == 0) || I2C_DMA_Busy(I2Cx)){
+			__enable_irq();
+			return;
+		}
+		// Select the next transaction
+		index = 0;
+		for(uint8_t i = 1; i < bus->count; i++){
+			if(I2C_Bus_Before(bus->queue[i], bus->queue[index]))
+				index = i;
+		}
+		next = bus->queue[index];
+		now = (uint32_t) SysTick_Get_Ticks();
+		// Missed its deadline before the first byte
+		if((next->offset == 0) && I2C_Bus_Expired(next, now)){
+			I2C_Bus_Remove(bus, index);
+			__enable_irq();
+			I2C_Bus_Complete(next, I2Cx_BUS_STATUS_EXPIRED);
+			continue;
+		}
+		// Claim the bus
+		bus->active = next;
+		next->status = I2Cx_BUS_STATUS_ACTIVE;
+		// Enable Global Interrupt
+		__enable_irq();
+
+		// STOP of the previous transfer still on the bus/Bus held by another master (retried in `I2C_Bus_Process()`)
+		if(I2C_Wait_Bus_Ready(I2Cx) != I2Cx_ERR_NONE){
+			next->status = I2Cx_BUS_STATUS_PENDING;
+			bus->active = NULL;
+			bus->dispatch = 0x01;
+			return;
+		}
+		// Read: Single transfer
+		if(next->direction == I2Cx_READ){
+			bus->chunk = next->len;
+			started = I2C_Master_Read_DMA(I2Cx, next->slaveAddress, next->registerAddress, next->buffer, next->len);
+		}
+		// Write: Register Address + Chunk
+		else{
+			bus->chunk = next->len - next->offset;
+			if(bus->chunk > I2Cx_BUS_CHUNK_SIZE)
+				bus->chunk = I2Cx_BUS_CHUNK_SIZE;
+			bus->tx[0] = next->registerAddress + ((next->flags & I2Cx_BUS_FLAG_REG_INC) ? next->offset : 0);
+			memcpy(&bus->tx[1], &next->buffer[next->offset], bus->chunk);
+			started = I2C_Master_Write_DMA(I2Cx, next->slaveAddress, bus->tx, bus->chunk + 1);
+		}
+
+		// NACK/Timeout during the address phase: drop the transaction
+		if(!started){
+			__disable_irq();
+			for(uint8_t i = 0; i < bus->count; i++){
+				if(bus->queue[i] == next){
+					I2C_Bus_Remove(bus, i);
+					break;
+				}
+			}
+			bus->active = NULL;
+			__enable_irq();
+			I2C_Bus_Complete(next, I2Cx_BUS_STATUS_ERROR);
+		}
+	}
+}
+
+/**
+ * @brief I2C DMA Transfer Complete Callback
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ */
+static void I2C_Bus_TC_Callback(I2C_REG_STRUCT* I2Cx){
+	// Local Variables
+	i2c_bus_t* bus = I2C_Bus_Get(I2Cx);
+	i2c_bus_transaction_t* done = bus->active;
+	// Spurious
+	if(done == NULL)
+		return;
+	// Account the chunk
+	done->offset += bus->chunk;
+	// Remaining chunks: back to the queue, so higher priorities can be inserted
+	if(done->offset < done->len){
+		done->status = I2Cx_BUS_STATUS_PENDING;
+		done = NULL;
+	}
+	// Fully transferred: remove from the queue
+	else{
+		for(uint8_t i = 0; i < bus->count; i++){
+			if(bus->queue[i] == done){
+				I2C_Bus_Remove(bus, i);
+				break;
+			}
+		}
+	}
+	// Release the bus
+	bus->active = NULL;
+	// Next transaction started from `I2C_Bus_Process()` (no polling in interrupt context)
+	bus->dispatch = 0x01;
+	// Client Callback
+	if(done != NULL)
+		I2C_Bus_Complete(done, I2Cx_BUS_STATUS_DONE);
+}
+
+/**
+ * @brief I2C DMA Transfer Error Callback
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ */
+static void I2C_Bus_TE_Callback(I2C_REG_STRUCT* I2Cx){
+	// Local Variables
+	i2c_bus_t* bus = I2C_Bus_Get(I2Cx);
+	i2c_bus_transaction_t* failed = bus->active;
+	// Spurious
+	if(failed == NULL)
+		return;
+	// Remove from the queue
+	for(uint8_t i = 0; i < bus->count; i++){
+		if(bus->queue[i] == failed){
+			I2C_Bus_Remove(bus, i);
+			break;
+		}
+	}
+	// Release the bus
+	bus->active = NULL;
+	// Next transaction started from `I2C_Bus_Process()` (no polling in interrupt context)
+	bus->dispatch = 0x01;
+	// Client Callback
+	I2C_Bus_Complete(failed, I2Cx_BUS_STATUS_ERROR);
+}
+
+/**
+ * @brief Initialises the Bus Manager of an I2C Instance
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2` (configured & enabled)
+ * @note Takes ownership of the I2C DMA Callbacks (`I2C_DMA_Register_Callback()`)
+ */
+void I2C_Bus_Init(I2C_REG_STRUCT* I2Cx){
+	// Local Variable
+	i2c_bus_t* bus = I2C_Bus_Get(I2Cx);
+	// Disable Global Interrupt
+	__disable_irq();
+	// Empty Queue
+	memset(bus, 0, sizeof(i2c_bus_t));
+	// Enable Global Interrupt
+	__enable_irq();
+	// Completion Callbacks
+	I2C_DMA_Register_Callback(I2Cx, I2C_Bus_TC_Callback, I2C_Bus_TE_Callback);
+}
+
+/**
+ * @brief Queues a transaction on the I2C Bus
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @param[in] transaction Pointer to the I2C Bus Transaction
+ * @returns - `0x00`: Failure (Queue full/Invalid length/Already queued)
+ * @returns - `0x01`: Success
+ */
+uint8_t I2C_Bus_Submit(I2C_REG_STRUCT* I2Cx, i2c_bus_transaction_t* transaction){
+	// Local Variable
+	i2c_bus_t* bus = I2C_Bus_Get(I2Cx);
+	// Invalid Transaction
+	if((transaction == NULL) || (transaction->len == 0) || (transaction->buffer == NULL))
+		return 0x00;
+	// Disable Global Interrupt
+	__disable_irq();
+	// Queue Full/Already queued
+	if((bus->count >= I2Cx_BUS_QUEUE_SIZE) ||
+	   (transaction->status == I2Cx_BUS_STATUS_PENDING) || (transaction->status == I2Cx_BUS_STATUS_ACTIVE)){
+		__enable_irq();
+		return 0x00;
+	}
+	// Enqueue
+	transaction->offset = 0;
+	transaction->sequence = bus->sequence++;
+	transaction->status = I2Cx_BUS_STATUS_PENDING;
+	bus->queue[bus->count++] = transaction;
+	// Enable Global Interrupt
+	__enable_irq();
+	// Start if idle (from interrupt context, e.g. a completion callback, left to `I2C_Bus_Process()`)
+	if(__get_IPSR() == 0)
+		I2C_Bus_Dispatch(I2Cx);
+	else
+		bus->dispatch = 0x01;
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Removes a pending transaction from the I2C Bus
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @param[in] transaction Pointer to the I2C Bus Transaction
+ * @returns - `0x00`: Failure (Not queued/Currently on the bus)
+ * @returns - `0x01`: Success
+ */
+uint8_t I2C_Bus_Cancel(I2C_REG_STRUCT* I2Cx, i2c_bus_transaction_t* transaction){
+	// Local Variable
+	i2c_bus_t* bus = I2C_Bus_Get(I2Cx);
+	// Disable Global Interrupt
+	__disable_irq();
+	// Currently on the bus
+	if(bus->active == transaction){
+		__enable_irq();
+		return 0x00;
+	}
+	// Search the queue
+	for(uint8_t i = 0; i < bus->count; i++){
+		if(bus->queue[i] == transaction){
+			I2C_Bus_Remove(bus, i);
+			transaction->status = I2Cx_BUS_STATUS_IDLE;
+			__enable_irq();
+			return 0x01;
+		}
+	}
+	// Enable Global Interrupt
+	__enable_irq();
+	// Not queued
+	return 0x00;
+}
+
+/**
+ * @brief Expires overdue transactions & starts the next transaction
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @note Call from the main loop: transfers completed in interrupt context only release the bus,
+ * 		 the next transaction/chunk is started here
+ */
+void I2C_Bus_Process(I2C_REG_STRUCT* I2Cx){
+	// Local Variables
+	i2c_bus_t* bus = I2C_Bus_Get(I2Cx);
+	i2c_bus_transaction_t* expired = NULL;
+	uint32_t now = 0x00;
+
+	// Expire overdue transactions one at a time (callbacks outside the critical section)
+	do{
+		expired = NULL;
+		__disable_irq();
+		now = (uint32_t) SysTick_Get_Ticks();
+		for(uint8_t i = 0; i < bus->count; i++){
+			i2c_bus_transaction_t* transaction = bus->queue[i];
+			if((transaction != bus->active) && (transaction->offset == 0) && I2C_Bus_Expired(transaction, now)){
+				I2C_Bus_Remove(bus, i);
+				expired = transaction;
+				break;
+			}
+		}
+		__enable_irq();
+		if(expired != NULL)
+			I2C_Bus_Complete(expired, I2Cx_BUS_STATUS_EXPIRED);
+	}while(expired != NULL);
+
+	// Start the next transaction (no-op if a transfer is in flight)
+	I2C_Bus_Dispatch(I2Cx);
+}
+
+/**
+ * @brief Checks whether the bus waits for `I2C_Bus_Process()` to start the next transaction
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @returns - `0x00`: Nothing to start
+ * @returns - `0x01`: Bus released in interrupt context/Transaction queued from interrupt context
+ */
+uint8_t I2C_Bus_Dispatch_Pending(I2C_REG_STRUCT* I2Cx){
+	// Dispatch Request
+	return I2C_Bus_Get(I2Cx)->dispatch;
+}
+
+/**
+ * @brief Retrieves the number of queued transactions
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @returns Number of pending/active transactions
+ */
+uint8_t I2C_Bus_Pending(I2C_REG_STRUCT* I2Cx){
+	// Queue Count
+	return I2C_Bus_Get(I2Cx)->count;
+}
@@ -67,6 +67,135 @@ uint16_t I2C_Calc_CCR(uint8_t i2cMode, uint8_t i2cDuty, uint8_t i2cClockFrequenc
 	return (uint16_t) (calculated_CCR & 0xFFFF);
 }
 
+/**
+ * @brief Smallest CCR satisfying a minimum SCL phase duration
+ * @param[in] time_ns Minimum phase duration (in ns)
+ * @param[in] freq_MHz I2C Module Clock Frequency (in MHz)
+ * @param[in] cycles Number of CCR periods in the phase (e.g. Fast Mode DUTY = 1: tLOW = 16 * CCR)
+ * @returns ceil(time_ns * freq_MHz / (1000 * cycles))
+ */
+static uint32_t I2C_Calc_CCR_Min(uint32_t time_ns, uint8_t freq_MHz, uint8_t cycles){
+	// Ceiling Division
+	return (((time_ns * freq_MHz) + ((1000 * cycles) - 1)) / (1000 * cycles));
+}
+
+/**
+ * @brief Smallest CCR not exceeding the requested SCL frequency
+ * @param[in] apb1Clock I2C Module Clock (in Hz)
+ * @param[in] speed_Hz Requested SCL Frequency (in Hz)
+ * @param[in] cycles Number of CCR periods in one SCL period (2, 3 or 25)
+ * @returns ceil(apb1Clock / (cycles * speed_Hz)), not limited to CCR[11:0] (low speeds exceed it)
+ */
+static uint32_t I2C_Calc_CCR_Speed(uint32_t apb1Clock, uint32_t speed_Hz, uint8_t cycles){
+	// Ceiling Division
+	return ((apb1Clock + ((cycles * speed_Hz) - 1)) / (cycles * speed_Hz));
+}
+
+/**
+ * @brief Calculates the SCL frequency produced by a Configuration Structure
+ * @param[in] I2C_CONFIGx I2C Configuration Structure (`freq_MHz`, `mode`, `duty`, `CCR`)
+ * @returns SCL Frequency (in Hz), `0` for an invalid CCR
+ * @note Ideal value: SCL rise/fall times stretch the real period slightly
+ */
+uint32_t I2C_Get_SCL_Freq(i2c_config_t* I2C_CONFIGx){
+	// Local Variables
+	uint32_t clock = I2C_CONFIGx->freq_MHz * FREQ_1MHz;
+	uint32_t cycles = 0;
+	// Invalid CCR
+	if(I2C_CONFIGx->CCR == 0)
+		return 0;
+	// SCL Period in CCR units
+	if(I2C_CONFIGx->mode == I2Cx_MODE_STD)
+		cycles = 2;
+	else
+		cycles = (I2C_CONFIGx->duty == I2Cx_DUTY_FAST) ? 25 : 3;
+	// SCL = I2C Clock / (cycles * CCR)
+	return (clock / (cycles * I2C_CONFIGx->CCR));
+}
+
+/**
+ * @brief Selects the fastest compliant CCR/DUTY/TRISE for a bus speed from the live APB1 Clock
+ * @param[in,out] I2C_CONFIGx I2C Configuration Structure (`freq_MHz`, `mode`, `duty`, `CCR`, `TRISE` are updated)
+ * @param[in] speed_Hz Requested SCL Frequency (in Hz): `I2Cx_SPEED_STD`, `I2Cx_SPEED_FAST` or lower
+ * @returns Achieved SCL Frequency (in Hz), `0` if APB1 cannot clock the I2C in the required mode or the
+ * 			speed needs a CCR above `I2Cx_CCR_MAX` (the configuration is then left untouched)
+ */
+uint32_t I2C_Timing_Solve(i2c_config_t* I2C_CONFIGx, uint32_t speed_Hz){
+	// Local Variables
+	uint32_t apb1Clock = RCC_Get_APB1Clock();
+	uint8_t freq_MHz = (uint8_t)(apb1Clock / FREQ_1MHz);
+	uint32_t CCR = 0, CCR_duty = 0, temp = 0;
+	uint32_t SCL = 0, SCL_duty = 0;
+
+	// Invalid request/I2C Module Clock out of range
+	if((speed_Hz == 0) || (freq_MHz < I2Cx_FREQ_MIN_MHz) || (freq_MHz > I2Cx_FREQ_MAX_MHz))
+		return 0;
+	// Fast Mode ceiling
+	if(speed_Hz > I2Cx_SPEED_FAST)
+		speed_Hz = I2Cx_SPEED_FAST;
+
+	// Standard Mode: Thigh = Tlow = CCR * Tpclk
+	if(speed_Hz <= I2Cx_SPEED_STD){
+		// Requested speed
+		CCR = I2C_Calc_CCR_Speed(apb1Clock, speed_Hz, 2);
+		// tLOW/tHIGH minimums
+		temp = I2C_Calc_CCR_Min(I2Cx_STD_TLOW_MIN_NS, freq_MHz, 1);
+		if(CCR < temp)
+			CCR = temp;
+		if(CCR < I2Cx_CCR_STD_MIN)
+			CCR = I2Cx_CCR_STD_MIN;
+		// Too slow: the hardware would keep only CCR[11:0] (a much faster bus)
+		if(CCR > I2Cx_CCR_MAX)
+			return 0;
+		// Configuration
+		I2C_CONFIGx->freq_MHz = freq_MHz;
+		I2C_CONFIGx->mode = I2Cx_MODE_STD;
+		I2C_CONFIGx->duty = I2Cx_DUTY_NORMAL;
+		I2C_CONFIGx->CCR = CCR;
+	}
+	// Fast Mode
+	else{
+		// FREQ must be at least 4MHz
+		if(freq_MHz < I2Cx_FREQ_FAST_MIN_MHz)
+			return 0;
+		// DUTY = 0: Thigh = CCR * Tpclk, Tlow = 2 * CCR * Tpclk
+		CCR = I2C_Calc_CCR_Speed(apb1Clock, speed_Hz, 3);
+		temp = I2C_Calc_CCR_Min(I2Cx_FAST_TLOW_MIN_NS, freq_MHz, 2);
+		if(CCR < temp)
+			CCR = temp;
+		temp = I2C_Calc_CCR_Min(I2Cx_FAST_THIGH_MIN_NS, freq_MHz, 1);
+		if(CCR < temp)
+			CCR = temp;
+		if(CCR < I2Cx_CCR_FAST_MIN)
+			CCR = I2Cx_CCR_FAST_MIN;
+		SCL = apb1Clock / (3 * CCR);
+		// DUTY = 1: Thigh = 9 * CCR * Tpclk, Tlow = 16 * CCR * Tpclk
+		CCR_duty = I2C_Calc_CCR_Speed(apb1Clock, speed_Hz, 25);
+		temp = I2C_Calc_CCR_Min(I2Cx_FAST_TLOW_MIN_NS, freq_MHz, 16);
+		if(CCR_duty < temp)
+			CCR_duty = temp;
+		temp = I2C_Calc_CCR_Min(I2Cx_FAST_THIGH_MIN_NS, freq_MHz, 9);
+		if(CCR_duty < temp)
+			CCR_duty = temp;
+		if(CCR_duty < I2Cx_CCR_FAST_MIN)
+			CCR_duty = I2Cx_CCR_FAST_MIN;
+		SCL_duty = apb1Clock / (25 * CCR_duty);
+		// Out of CCR[11:0] (cannot happen above `I2Cx_SPEED_STD` with FREQ <= 36MHz, kept for safety)
+		if((CCR > I2Cx_CCR_MAX) || (CCR_duty > I2Cx_CCR_MAX))
+			return 0;
+		// Keep the faster one
+		I2C_CONFIGx->freq_MHz = freq_MHz;
+		I2C_CONFIGx->mode = I2Cx_MODE_FAST;
+		I2C_CONFIGx->duty = (SCL_duty > SCL) ? I2Cx_DUTY_FAST : I2Cx_DUTY_NORMAL;
+		I2C_CONFIGx->CCR = (SCL_duty > SCL) ? CCR_duty : CCR;
+	}
+
+	// Maximum Rise Time (1000ns Standard, 300ns Fast)
+	I2C_CONFIGx->TRISE = I2C_Calc_tRISE(I2C_CONFIGx->mode);
+	// Achieved SCL
+	return I2C_Get_SCL_Freq(I2C_CONFIGx);
+}
+
 /**
  * @brief Configures I2C as per the Configuration Structure
  * @param I2C_CONFIGx I2C Configuration Structure
@@ -90,6 +219,67 @@ void I2C_Config(i2c_config_t* I2C_CONFIGx){
 	I2C_CONFIGx->I2Cx->TRISE.REG = (I2C_CONFIGx->TRISE & 0x3F) << I2C_TRISE_TRISE_Pos;
 }
 
+/**
+ * @brief Busy waits for half an SCL period of the recovery clock
+ * @note Independent of SysTick, as recovery may run before/without it
+ */
+static void I2C_Recovery_Delay(void){
+	// Core cycles in `I2Cx_RECOVERY_HALF_PERIOD_US` (~4 cycles per iteration)
+	volatile uint32_t count = ((RCC_Get_CoreClock() / FREQ_1MHz) * I2Cx_RECOVERY_HALF_PERIOD_US) >> 2;
+	// Wait
+	while(count--);
+}
+
+/**
+ * @brief Releases a stuck bus and reinitialises the I2C Module
+ * @param[in] I2C_CONFIGx I2C Configuration Structure (same one passed to `I2C_Config()`)
+ * @returns - `0x00`: Failure (SDA still held LOW by a slave)
+ * @returns - `0x01`: Success
+ * @note - SCL is clocked as an open-drain GPIO (up to `I2Cx_RECOVERY_CLOCKS` pulses) until the slave releases SDA
+ * @note - A STOP condition is then generated manually and the module is reconfigured & enabled
+ */
+uint8_t I2C_Bus_Recovery(i2c_config_t* I2C_CONFIGx){
+	// Local Variables
+	gpio_config_t SCL = I2C_CONFIGx->SCL;
+	gpio_config_t SDA = I2C_CONFIGx->SDA;
+	uint8_t result = 0x00;
+	// Release the pins from the I2C Module
+	I2C_Disable(I2C_CONFIGx->I2Cx);
+	// Idle HIGH before switching to GPIO
+	GPIO_Set(&SCL);
+	GPIO_Set(&SDA);
+	// SCL & SDA: General Purpose Open-Drain
+	SCL.CNF = GPIOx_CNF_OUT_GP_OD;
+	SDA.CNF = GPIOx_CNF_OUT_GP_OD;
+	GPIO_Config(&SCL);
+	GPIO_Config(&SDA);
+	// Clock out the byte the slave is stuck in
+	for(uint8_t i = 0; (i < I2Cx_RECOVERY_CLOCKS) && !(GPIO_Get_State(&SDA)); i++){
+		// SCL LOW
+		GPIO_Reset(&SCL);
+		I2C_Recovery_Delay();
+		// SCL HIGH
+		GPIO_Set(&SCL);
+		I2C_Recovery_Delay();
+	}
+	// STOP Condition: SDA LOW -> HIGH while SCL is HIGH
+	GPIO_Reset(&SCL);
+	I2C_Recovery_Delay();
+	GPIO_Reset(&SDA);
+	I2C_Recovery_Delay();
+	GPIO_Set(&SCL);
+	I2C_Recovery_Delay();
+	GPIO_Set(&SDA);
+	I2C_Recovery_Delay();
+	// Bus released
+	result = GPIO_Get_State(&SDA) & GPIO_Get_State(&SCL);
+	// Reconfigure (Alternate Function pins + Software Reset clears BUSY) & Enable
+	I2C_Config(I2C_CONFIGx);
+	I2C_Enable(I2C_CONFIGx->I2Cx);
+	// Result
+	return result;
+}
+
 /**
  * @brief I2C load default values
  * @param I2C_CONFIGx I2C Configuration Structure
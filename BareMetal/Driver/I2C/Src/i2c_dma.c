@@ -1,3 +1,363 @@
 // Header
 #include "i2c_dma.h"
 
+// I2C DMA Handles: [0] -> `I2C1`, [1] -> `I2C2`
+static i2c_dma_handle_t i2c_dma_handle[2] = {0};
+
+// Static Variable for Memory Efficiency
+static uint32_t temp = 0x00;
+
+/**
+ * @brief Retrieves the DMA Transfer Handle of I2C
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @returns Pointer to the I2C DMA Transfer Handle
+ */
+__STATIC_INLINE__ i2c_dma_handle_t* I2C_DMA_Get_Handle(I2C_REG_STRUCT* I2Cx){
+	// I2C1: Index 0, I2C2: Index 1
+	return &i2c_dma_handle[(I2Cx == I2C1) ? 0 : 1];
+}
+
+/**
+ * @brief Configures the DMA Channel for I2C Data Transfer
+ * @param[in] DMA_channelX DMA Channel
+ * @param[in] direction `DMAx_DIR_READ_MEM` (TX), `DMAx_DIR_READ_PER` (RX)
+ */
+static void I2C_DMA_Channel_Config(DMA_CHANNEL_REG_STRUCT* DMA_channelX, uint8_t direction){
+	// DMA Configuration
+	dma_config_t dma_config = {
+		// DMA Channel
+		.DMA_Channel = DMA_channelX,
+		// Channel Properties
+		.channel = {
+			.direction = direction,
+			.mem2mem = DMAx_MEM2MEM_DISABLE,
+			.circular_mode = DMAx_CIRC_DISABLE,
+			.priority = DMAx_PRIORITY_VERY_HIGH
+		},
+		// Data Properties: Memory side increments, I2Cx->DR does not
+		.data = {
+			.srcDataSize = DMAx_DATA_SIZE_BIT_8,
+			.dstDataSize = DMAx_DATA_SIZE_BIT_8,
+			.srcInc = (direction == DMAx_DIR_READ_MEM) ? DMAx_INC_ENABLE : DMAx_INC_DISABLE,
+			.dstInc = (direction == DMAx_DIR_READ_MEM) ? DMAx_INC_DISABLE : DMAx_INC_ENABLE
+		},
+		// Interrupt
+		.interrupt = {
+			.TCIE = DMAx_IRQ_ENABLE,
+			.HTIE = DMAx_IRQ_DISABLE,
+			.TEIE = DMAx_IRQ_ENABLE
+		},
+	};
+	// Configure the Channel
+	DMA_Config(&dma_config);
+	// Clear stale flags of the previous transfer
+	DMA_CH_clear_flags(DMA_channelX, DMAx_FLAG_ALL);
+}
+
+/**
+ * @brief Releases the DMA resources held by the transfer
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @param[in] DMA_channelX DMA Channel
+ */
+static void I2C_DMA_Release(I2C_REG_STRUCT* I2Cx, DMA_CHANNEL_REG_STRUCT* DMA_channelX){
+	// Disable the DMA Channel + Clear its Flags + Free it for other requests
+	DMA_CH_Release(DMA_channelX);
+	// Disable DMA Requests + Last Transfer + Error Interrupt
+	I2Cx->CR2.REG &= ~(I2C_CR2_DMAEN | I2C_CR2_LAST | I2C_CR2_ITERREN);
+	// Restore Acknowledge Position
+	I2Cx->CR1.REG &= ~I2C_CR1_POS;
+}
+
+/**
+ * @brief Aborts a transfer that failed during the address phase
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @param[in] DMA_channelX DMA Channel
+ * @returns `0x00` (Failure)
+ */
+static uint8_t I2C_DMA_Abort(I2C_REG_STRUCT* I2Cx, DMA_CHANNEL_REG_STRUCT* DMA_channelX){
+	// Release DMA + Free the bus
+	I2C_DMA_Release(I2Cx, DMA_channelX);
+	I2C_sendStop(I2Cx);
+	I2C_Clear_Error(I2Cx);
+	// Restore Acknowledge for the next transfer
+	I2Cx->CR1.REG |= I2C_CR1_ACK;
+	// Update State
+	I2C_DMA_Get_Handle(I2Cx)->state = I2Cx_DMA_STATE_READY;
+	// Failure
+	return 0x00;
+}
+
+/**
+ * @brief I2C TX DMA Transfer Complete Callback (last byte is still in the shift register)
+ * @param[in] DMA_channelX DMA Channel
+ * @param[in] context I2C Instance: `I2C1`, `I2C2`
+ */
+static void I2C_DMA_TX_TC_Callback(DMA_CHANNEL_REG_STRUCT* DMA_channelX, void* context){
+	// Local Variables
+	I2C_REG_STRUCT* I2Cx = (I2C_REG_STRUCT *)context;
+	i2c_dma_handle_t* handle = I2C_DMA_Get_Handle(I2Cx);
+	// Release DMA
+	I2C_DMA_Release(I2Cx, DMA_channelX);
+	// STOP is generated on BTF (EV8_2) from the Event IRQ
+	handle->state = I2Cx_DMA_STATE_BUSY_TX_BTF;
+	I2C_IRQ_Enable(I2Cx, I2Cx_IRQ_EVENT);
+}
+
+/**
+ * @brief I2C DMA Transfer Error Callback (TX & RX)
+ * @param[in] DMA_channelX DMA Channel
+ * @param[in] context I2C Instance: `I2C1`, `I2C2`
+ */
+static void I2C_DMA_TE_Callback(DMA_CHANNEL_REG_STRUCT* DMA_channelX, void* context){
+	// Local Variables
+	I2C_REG_STRUCT* I2Cx = (I2C_REG_STRUCT *)context;
+	i2c_dma_handle_t* handle = I2C_DMA_Get_Handle(I2Cx);
+	// Release DMA + Free the bus
+	I2C_DMA_Release(I2Cx, DMA_channelX);
+	I2C_sendStop(I2Cx);
+	// Restore Acknowledge for the next transfer
+	I2Cx->CR1.REG |= I2C_CR1_ACK;
+	// Update State
+	handle->state = I2Cx_DMA_STATE_READY;
+	// User Callback
+	if(handle->TE_Callback != NULL)
+		handle->TE_Callback(I2Cx);
+}
+
+/**
+ * @brief I2C RX DMA Transfer Complete Callback
+ * @param[in] DMA_channelX DMA Channel
+ * @param[in] context I2C Instance: `I2C1`, `I2C2`
+ */
+static void I2C_DMA_RX_TC_Callback(DMA_CHANNEL_REG_STRUCT* DMA_channelX, void* context){
+	// Local Variables
+	I2C_REG_STRUCT* I2Cx = (I2C_REG_STRUCT *)context;
+	i2c_dma_handle_t* handle = I2C_DMA_Get_Handle(I2Cx);
+	// Release DMA
+	I2C_DMA_Release(I2Cx, DMA_channelX);
+	// Generate STOP (already programmed for single byte reception)
+	if(handle->len > 1)
+		I2C_sendStop(I2Cx);
+	// Restore Acknowledge for the next transfer
+	I2Cx->CR1.REG |= I2C_CR1_ACK;
+	// Update State
+	handle->state = I2Cx_DMA_STATE_READY;
+	// User Callback
+	if(handle->TC_Callback != NULL)
+		handle->TC_Callback(I2Cx);
+}
+
+/**
+ * @brief Registers the Transfer Complete & Transfer Error Callbacks
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @param[in] TC_Callback Called once the STOP condition of a successful transfer is generated
+ * @param[in] TE_Callback Called when the DMA reports a Transfer Error
+ * @note Callbacks are executed in interrupt context
+ */
+void I2C_DMA_Register_Callback(I2C_REG_STRUCT* I2Cx, I2C_DMA_Callback_t TC_Callback, I2C_DMA_Callback_t TE_Callback){
+	// Local Handle
+	i2c_dma_handle_t* handle = I2C_DMA_Get_Handle(I2Cx);
+	// Disable Global Interrupt
+	__disable_irq();
+	// Register Callbacks
+	handle->TC_Callback = TC_Callback;
+	handle->TE_Callback = TE_Callback;
+	// Enable Global Interrupt
+	__enable_irq();
+}
+
+/**
+ * @brief Retrieves the DMA Transfer State of I2C
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @returns - `0x00`: No transfer in progress
+ * @returns - `0x01`: Transfer in progress
+ */
+uint8_t I2C_DMA_Busy(I2C_REG_STRUCT* I2Cx){
+	// Transfer State
+	return (I2C_DMA_Get_Handle(I2Cx)->state != I2Cx_DMA_STATE_READY);
+}
+
+/**
+ * @brief Starts a DMA backed Master Write
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @param[in] slaveAddress Target I2C Slave Address
+ * @param[in] buffer Pointer to buffer to be transmitted (must stay valid until completion)
+ * @param[in] len Number of bytes to be transmitted
+ * @returns - `0x00`: Failure (Transfer in progress/Slave mode active/Bus busy/Invalid length/NACK/Timeout)
+ * @returns - `0x01`: Success (Transfer started)
+ */
+uint8_t I2C_Master_Write_DMA(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t* buffer, uint16_t len){
+	// Local Variables
+	i2c_dma_handle_t* handle = I2C_DMA_Get_Handle(I2Cx);
+	DMA_CHANNEL_REG_STRUCT* DMA_channelX = I2C_DMA_Get_TX_Channel(I2Cx);
+	// Transfer in progress or nothing to transfer
+	if((handle->state != I2Cx_DMA_STATE_READY) || (len == 0) || !(I2C_busReady(I2Cx)))
+		return 0x00;
+	// Interrupts owned by the slave (re-routing them would orphan `I2C_Slave_EV_IRQ_Handler()`)
+	if(I2C_Slave_Is_Active(I2Cx))
+		return 0x00;
+	// Channel shared with other requests (e.g. `USART1` TX on Channel 4)
+	if(!DMA_CH_Allocate(DMA_channelX, (I2Cx == I2C1) ? DMAx_REQ_I2C1_TX : DMAx_REQ_I2C2_TX))
+		return 0x00;
+	DMA_CH_Register_Callback(DMA_channelX, I2C_DMA_TX_TC_Callback, NULL, I2C_DMA_TE_Callback, I2Cx);
+	// Update State
+	handle->state = I2Cx_DMA_STATE_BUSY_TX;
+	handle->len = len;
+	// Route the I2C Event/Error Interrupts to the DMA transfer
+	I2C_IRQ_Register_Handler(I2Cx, I2C_DMA_EV_IRQ_Handler, I2C_DMA_ER_IRQ_Handler);
+	// Memory -> I2Cx->DR
+	I2C_DMA_Channel_Config(DMA_channelX, DMAx_DIR_READ_MEM);
+	DMA_Transfer_Config(DMA_channelX, buffer, (void *)&I2Cx->DR.REG, len);
+	// Arm the DMA: TXE is not set during address phase, so no request is lost
+	DMA_CH_enable(DMA_channelX);
+	I2Cx->CR2.REG &= ~I2C_CR2_LAST;
+	I2C_DMA_enable(I2Cx);
+	// Start Sequence
+	I2C_sendStart(I2Cx);
+	// Wait for Start condition (EV5)
+	if(I2C_Wait_Flag(I2Cx, I2C_SR1_SB) != I2Cx_ERR_NONE)
+		return I2C_DMA_Abort(I2Cx, DMA_channelX);
+	// Send Slave Address with Write Privilege
+	I2C_writeAddress(I2Cx, slaveAddress);
+	// Wait for ADDR flag (EV6), NACK reported as AF
+	if(I2C_Wait_Flag(I2Cx, I2C_SR1_ADDR) != I2Cx_ERR_NONE)
+		return I2C_DMA_Abort(I2Cx, DMA_channelX);
+	// Bus errors during the data phase are reported by the Error IRQ
+	I2C_IRQ_Enable(I2Cx, I2Cx_IRQ_ERROR);
+	// Clear ADDR flag (SR1 followed by SR2): DMA takes over from EV8_1
+	temp = I2Cx->SR1.REG;
+	temp = I2Cx->SR2.REG;
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Starts a DMA backed Master Read from a Register Address
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @param[in] slaveAddress Target I2C Slave Address
+ * @param[in] registerAddress Starting Register Address
+ * @param[out] buffer Pointer to buffer to store the received data (must stay valid until completion)
+ * @param[in] len Number of bytes to be received
+ * @returns - `0x00`: Failure (Transfer in progress/Slave mode active/Bus busy/Invalid length/NACK/Timeout)
+ * @returns - `0x01`: Success (Transfer started)
+ */
+uint8_t I2C_Master_Read_DMA(I2C_REG_STRUCT* I2Cx, uint8_t slaveAddress, uint8_t registerAddress, uint8_t* buffer, uint16_t len){
+	// Local Variables
+	i2c_dma_handle_t* handle = I2C_DMA_Get_Handle(I2Cx);
+	DMA_CHANNEL_REG_STRUCT* DMA_channelX = I2C_DMA_Get_RX_Channel(I2Cx);
+	// Transfer in progress or nothing to transfer
+	if((handle->state != I2Cx_DMA_STATE_READY) || (len == 0) || !(I2C_busReady(I2Cx)))
+		return 0x00;
+	// Interrupts owned by the slave (re-routing them would orphan `I2C_Slave_EV_IRQ_Handler()`)
+	if(I2C_Slave_Is_Active(I2Cx))
+		return 0x00;
+	// Channel shared with other requests (e.g. `USART1` RX on Channel 5)
+	if(!DMA_CH_Allocate(DMA_channelX, (I2Cx == I2C1) ? DMAx_REQ_I2C1_RX : DMAx_REQ_I2C2_RX))
+		return 0x00;
+	DMA_CH_Register_Callback(DMA_channelX, I2C_DMA_RX_TC_Callback, NULL, I2C_DMA_TE_Callback, I2Cx);
+	// Update State
+	handle->state = I2Cx_DMA_STATE_BUSY_RX;
+	handle->len = len;
+	// Route the I2C Event/Error Interrupts to the DMA transfer
+	I2C_IRQ_Register_Handler(I2Cx, I2C_DMA_EV_IRQ_Handler, I2C_DMA_ER_IRQ_Handler);
+	// Write the Register Address (No STOP)
+	if(I2C_Master_Write_Start_Reg(I2Cx, slaveAddress, registerAddress) != I2Cx_ERR_NONE){
+		DMA_CH_Release(DMA_channelX);
+		handle->state = I2Cx_DMA_STATE_READY;
+		return 0x00;
+	}
+	// I2Cx->DR -> Memory
+	I2C_DMA_Channel_Config(DMA_channelX, DMAx_DIR_READ_PER);
+	DMA_Transfer_Config(DMA_channelX, (void *)&I2Cx->DR.REG, buffer, len);
+	DMA_CH_enable(DMA_channelX);
+	// Acknowledge Configuration
+	if(len == 1){
+		// Single byte: NACK the only byte
+		I2Cx->CR1.REG &= ~(I2C_CR1_ACK | I2C_CR1_POS);
+		I2Cx->CR2.REG &= ~I2C_CR2_LAST;
+	}
+	else if(len == 2){
+		// Two bytes: NACK applies to the second byte (POS)
+		I2Cx->CR1.REG &= ~I2C_CR1_ACK;
+		I2Cx->CR1.REG |= I2C_CR1_POS;
+		I2Cx->CR2.REG |= I2C_CR2_LAST;
+	}
+	else{
+		// N bytes: hardware NACKs the byte following EOT_1
+		I2Cx->CR1.REG &= ~I2C_CR1_POS;
+		I2Cx->CR1.REG |= I2C_CR1_ACK;
+		I2Cx->CR2.REG |= I2C_CR2_LAST;
+	}
+	I2C_DMA_enable(I2Cx);
+	// Repeated START Condition (Switch to Read Mode)
+	I2C_sendStart(I2Cx);
+	// Wait for Start condition (EV5)
+	if(I2C_Wait_Flag(I2Cx, I2C_SR1_SB) != I2Cx_ERR_NONE)
+		return I2C_DMA_Abort(I2Cx, DMA_channelX);
+	// Send Slave Address with Read Privilege
+	I2C_readAddress(I2Cx, slaveAddress);
+	// Wait for ADDR flag (EV6), NACK reported as AF
+	if(I2C_Wait_Flag(I2Cx, I2C_SR1_ADDR) != I2Cx_ERR_NONE)
+		return I2C_DMA_Abort(I2Cx, DMA_channelX);
+	// Bus errors during the data phase are reported by the Error IRQ
+	I2C_IRQ_Enable(I2Cx, I2Cx_IRQ_ERROR);
+	// Clear ADDR flag (SR1 followed by SR2)
+	temp = I2Cx->SR1.REG;
+	temp = I2Cx->SR2.REG;
+	// Single byte: STOP must be programmed right after ADDR is cleared (EV6_1)
+	if(len == 1)
+		I2C_sendStop(I2Cx);
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Services the I2C Event Interrupt (BTF after the last DMA transfer)
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ */
+void I2C_DMA_EV_IRQ_Handler(I2C_REG_STRUCT* I2Cx){
+	// Local Handle
+	i2c_dma_handle_t* handle = I2C_DMA_Get_Handle(I2Cx);
+	// Last byte shifted out (EV8_2)
+	if((handle->state == I2Cx_DMA_STATE_BUSY_TX_BTF) && (I2Cx->SR1.REG & I2C_SR1_BTF)){
+		// Generate STOP condition (clears BTF)
+		I2C_sendStop(I2Cx);
+		// Disable the Event Interrupt (keep NVIC line for other users)
+		I2Cx->CR2.REG &= ~I2C_CR2_ITEVTEN;
+		// Update State
+		handle->state = I2Cx_DMA_STATE_READY;
+		// User Callback
+		if(handle->TC_Callback != NULL)
+			handle->TC_Callback(I2Cx);
+	}
+}
+
+/**
+ * @brief Services the I2C Error Interrupt (AF/ARLO/BERR/OVR during the DMA data phase)
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ */
+void I2C_DMA_ER_IRQ_Handler(I2C_REG_STRUCT* I2Cx){
+	// Local Variables
+	i2c_dma_handle_t* handle = I2C_DMA_Get_Handle(I2Cx);
+	uint8_t error = I2C_Get_Error(I2Cx);
+	// Clear the Error Flags
+	I2C_Clear_Error(I2Cx);
+	// Error Statistics (address phase errors are counted by `I2C_Wait_Flag()`)
+	I2C_Count_Error(I2Cx, error);
+	// No DMA transfer in progress
+	if((handle->state == I2Cx_DMA_STATE_READY) || (error == I2Cx_ERR_NONE))
+		return;
+	// Release DMA
+	I2C_DMA_Release(I2Cx, (handle->state == I2Cx_DMA_STATE_BUSY_RX) ? I2C_DMA_Get_RX_Channel(I2Cx) : I2C_DMA_Get_TX_Channel(I2Cx));
+	I2Cx->CR2.REG &= ~I2C_CR2_ITEVTEN;
+	// Master keeps the bus on NACK/Overrun: release it
+	if(!(error & (I2Cx_ERR_BERR | I2Cx_ERR_ARLO)))
+		I2C_sendStop(I2Cx);
+	// Restore Acknowledge for the next transfer
+	I2Cx->CR1.REG |= I2C_CR1_ACK;
+	// Update State
+	handle->state = I2Cx_DMA_STATE_READY;
+	// User Callback
+	if(handle->TE_Callback != NULL)
+		handle->TE_Callback(I2Cx);
+}
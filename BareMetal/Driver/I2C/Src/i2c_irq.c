@@ -4,6 +4,10 @@
 // Temporary Variable for Memory Efficiency
 static uint32_t reg = 0x00;
 
+// Registered Handlers: [0] -> `I2C1`, [1] -> `I2C2`
+static I2C_IRQ_Handler_t I2C_EV_Handler[2] = {NULL};
+static I2C_IRQ_Handler_t I2C_ER_Handler[2] = {NULL};
+
 /**
  * @brief Enables the I2C Interrupt
  * @param I2Cx I2C Instance: `I2C1`, `I2C2`
@@ -62,3 +66,53 @@ void I2C_IRQ_Disable(I2C_REG_STRUCT* I2Cx, uint8_t I2C_IRQ_status){
 	I2Cx->CR2.REG = reg;
 }
 
+/**
+ * @brief Registers the Event & Error Interrupt Handlers of an I2C Instance
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @param[in] EV_Handler Called from `I2Cx_EV_IRQHandler()` (may be NULL)
+ * @param[in] ER_Handler Called from `I2Cx_ER_IRQHandler()` (may be NULL)
+ * @note Master DMA transfers and Slave mode register their own handlers
+ */
+void I2C_IRQ_Register_Handler(I2C_REG_STRUCT* I2Cx, I2C_IRQ_Handler_t EV_Handler, I2C_IRQ_Handler_t ER_Handler){
+	// I2C1: Index 0, I2C2: Index 1
+	uint8_t index = (I2Cx == I2C1) ? 0 : 1;
+	// Disable Global Interrupt
+	__disable_irq();
+	// Register Handlers
+	I2C_EV_Handler[index] = EV_Handler;
+	I2C_ER_Handler[index] = ER_Handler;
+	// Enable Global Interrupt
+	__enable_irq();
+}
+
+/**
+ * @brief I2C1 Event ISR
+ */
+__attribute__((weak)) void I2C1_EV_IRQHandler(void){
+	if(I2C_EV_Handler[0] != NULL)
+		I2C_EV_Handler[0](I2C1);
+}
+
+/**
+ * @brief I2C1 Error ISR
+ */
+__attribute__((weak)) void I2C1_ER_IRQHandler(void){
+	if(I2C_ER_Handler[0] != NULL)
+		I2C_ER_Handler[0](I2C1);
+}
+
+/**
+ * @brief I2C2 Event ISR
+ */
+__attribute__((weak)) void I2C2_EV_IRQHandler(void){
+	if(I2C_EV_Handler[1] != NULL)
+		I2C_EV_Handler[1](I2C2);
+}
+
+/**
+ * @brief I2C2 Error ISR
+ */
+__attribute__((weak)) void I2C2_ER_IRQHandler(void){
+	if(I2C_ER_Handler[1] != NULL)
+		I2C_ER_Handler[1](I2C2);
+}
@@ -12,10 +12,8 @@
 uint8_t I2C_RB_TX_Byte(I2C_REG_STRUCT* I2Cx, ring_buffer_t* ring_buffer){
 	// Dequeue data from the ring buffer & store it in I2Cx->DR
 	if(Ring_Buffer_Dequeue(ring_buffer, &I2Cx->DR.REG)){
-		// Wait until the data is transmitted
-		while(!(I2Cx->SR1.REG & (I2C_SR1_TXE | I2C_SR1_BTF)));
-		// Success
-		return 0x01;
+		// Wait until the data is transmitted (bounded)
+		return (I2C_Wait_Flag(I2Cx, (I2C_SR1_TXE | I2C_SR1_BTF)) == I2Cx_ERR_NONE);
 	}
 	// Failure
 	return 0x00;
@@ -0,0 +1,239 @@
+// Header
+#include "i2c_slave.h"
+
+// Active Slaves: [0] -> `I2C1`, [1] -> `I2C2`
+static i2c_slave_t* i2c_slave[2] = {NULL};
+
+// Static Variable for Memory Efficiency
+static uint32_t temp = 0x00;
+
+/**
+ * @brief Retrieves the Slave Index of I2C
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @returns `0` for `I2C1`, `1` for `I2C2`
+ */
+__STATIC_INLINE__ uint8_t I2C_Slave_Index(I2C_REG_STRUCT* I2Cx){
+	// I2C1: Index 0, I2C2: Index 1
+	return (I2Cx == I2C1) ? 0 : 1;
+}
+
+/**
+ * @brief Consumes the bytes acknowledged by the host
+ * @param[in] slave Pointer to the I2C Slave Structure
+ * @note The last byte written to DR was NACKed (never shifted out): it stays in `tx` (Mailbox)
+ * 		 or its register is read again by the next host read (Register File)
+ * @note Mailbox: when the NACKed byte was an idle byte, every queued byte peeked was acknowledged
+ */
+static void I2C_Slave_TX_Commit(i2c_slave_t* slave){
+	// Local Variables
+	uint8_t dummy = 0x00;
+	uint16_t acked = 0;
+	// Mailbox bytes on the wire
+	if(slave->reg == slave->mailbox){
+		// The NACKed preload is a queued byte only if it came from `tx`
+		acked = slave->tx_inflight;
+		if(slave->tx_last_from_queue && (acked > 0))
+			acked--;
+		if(slave->tx != NULL){
+			for(uint16_t i = 0; i < acked; i++)
+				Ring_Buffer_Dequeue(slave->tx, &dummy);
+		}
+	}
+	// Register Pointer back on the preloaded (NACKed) register
+	else if(slave->tx_inflight > 0){
+		slave->reg--;
+	}
+	// Reset
+	slave->tx_inflight = 0;
+	slave->tx_last_from_queue = 0x00;
+}
+
+/**
+ * @brief Configures the I2C Instance as an Interrupt driven Slave
+ * @param[in] slave Pointer to the I2C Slave Structure (must stay valid while in slave mode)
+ * @returns - `0x00`: Failure (Invalid address/Instance busy)
+ * @returns - `0x01`: Success
+ * @note - Event, Buffer & Error Interrupts are enabled, clock stretching is kept as a safety net
+ * @note - At 400kHz a byte lasts ~22.5us: callbacks must return well within that to avoid stretching
+ */
+uint8_t I2C_Slave_Init(i2c_slave_t* slave){
+	// Local Variables
+	I2C_REG_STRUCT* I2Cx = slave->i2c_config.I2Cx;
+	uint8_t index = I2C_Slave_Index(I2Cx);
+	// Reserved 7-bit addresses (0x00-0x07, 0x78-0x7F)
+	if((slave->ownAddress < 0x08) || (slave->ownAddress > 0x77))
+		return 0x00;
+	// Instance already in slave mode
+	if((i2c_slave[index] != NULL) && (i2c_slave[index] != slave))
+		return 0x00;
+
+	// Reset State
+	slave->reg = 0x00;
+	slave->expect_reg = 0x01;
+	slave->gencall = 0x00;
+	slave->direction = I2Cx_WRITE;
+	slave->tx_inflight = 0x00;
+	slave->tx_last_from_queue = 0x00;
+	slave->rx_overrun = 0x00;
+	// Clock + GPIO + Timing (+ Software Reset)
+	I2C_Config(&slave->i2c_config);
+	// Own Address: 7-bit mode, bit 14 must be kept at 1 by software
+	I2Cx->OAR1.REG = (1 << 14) | ((uint32_t)(slave->ownAddress & 0x7F) << I2C_OAR1_ADD1_Pos);
+	// General Call
+	if(slave->generalCall == I2Cx_GENCALL_ENABLE)
+		I2Cx->CR1.REG |= I2C_CR1_ENGC;
+	else
+		I2Cx->CR1.REG &= ~I2C_CR1_ENGC;
+	// Enable the I2C Module (ACK can only be set once PE = 1)
+	I2C_Enable(I2Cx);
+	I2Cx->CR1.REG |= I2C_CR1_ACK;
+	// Interrupt Routing
+	i2c_slave[index] = slave;
+	I2C_IRQ_Register_Handler(I2Cx, I2C_Slave_EV_IRQ_Handler, I2C_Slave_ER_IRQ_Handler);
+	// Event + Buffer + Error Interrupts
+	I2C_IRQ_Enable(I2Cx, I2Cx_IRQ_ALL);
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Releases the I2C Instance from Slave Mode
+ * @param[in] slave Pointer to the I2C Slave Structure
+ */
+void I2C_Slave_DeInit(i2c_slave_t* slave){
+	// Local Variable
+	I2C_REG_STRUCT* I2Cx = slave->i2c_config.I2Cx;
+	// Disable Interrupts
+	I2C_IRQ_Disable(I2Cx, I2Cx_IRQ_ALL);
+	I2C_IRQ_Register_Handler(I2Cx, NULL, NULL);
+	// Stop Acknowledging
+	I2Cx->CR1.REG &= ~(I2C_CR1_ACK | I2C_CR1_ENGC);
+	// Release
+	i2c_slave[I2C_Slave_Index(I2Cx)] = NULL;
+}
+
+/**
+ * @brief Checks whether an I2C Instance is in Slave Mode
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @returns - `0x00`: Not in slave mode
+ * @returns - `0x01`: Slave registered (`I2C_Slave_Init()` without `I2C_Slave_DeInit()`)
+ */
+uint8_t I2C_Slave_Is_Active(I2C_REG_STRUCT* I2Cx){
+	// Registered Slave
+	return (i2c_slave[I2C_Slave_Index(I2Cx)] != NULL);
+}
+
+/**
+ * @brief Services the I2C Event Interrupt in Slave Mode (ADDR/RXNE/TXE/STOPF)
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ */
+void I2C_Slave_EV_IRQ_Handler(I2C_REG_STRUCT* I2Cx){
+	// Local Variables
+	i2c_slave_t* slave = i2c_slave[I2C_Slave_Index(I2Cx)];
+	uint32_t SR1 = I2Cx->SR1.REG;
+	uint32_t SR2 = 0x00;
+	uint8_t byte = 0x00;
+	// Not in slave mode
+	if(slave == NULL)
+		return;
+
+	// Address matched (EV1): SR1 read above, SR2 read clears ADDR
+	if(SR1 & I2C_SR1_ADDR){
+		SR2 = I2Cx->SR2.REG;
+		slave->direction = (SR2 & I2C_SR2_TRA) ? I2Cx_READ : I2Cx_WRITE;
+		slave->gencall = (SR2 & I2C_SR2_GENCALL) ? 0x01 : 0x00;
+		// Host write starts with the Register Address
+		if(slave->direction == I2Cx_WRITE)
+			slave->expect_reg = 0x01;
+		// Host read starts from the current Register Pointer
+		else{
+			slave->tx_inflight = 0x00;
+			slave->tx_last_from_queue = 0x00;
+		}
+	}
+
+	// Byte received (EV2)
+	if(SR1 & I2C_SR1_RXNE){
+		byte = (uint8_t) I2Cx->DR.REG;
+		// General Call: stream as is
+		if(slave->gencall){
+			if((slave->rx == NULL) || !Ring_Buffer_Enqueue(slave->rx, byte))
+				slave->rx_overrun++;
+		}
+		// Register Address
+		else if(slave->expect_reg){
+			slave->reg = byte;
+			slave->expect_reg = 0x00;
+		}
+		// Mailbox
+		else if(slave->reg == slave->mailbox){
+			if((slave->rx == NULL) || !Ring_Buffer_Enqueue(slave->rx, byte))
+				slave->rx_overrun++;
+		}
+		// Register File
+		else{
+			if(slave->Write_Callback != NULL)
+				slave->Write_Callback(slave->reg, byte);
+			slave->reg++;
+		}
+	}
+
+	// Data register empty (EV3)
+	if((SR1 & I2C_SR1_TXE) && (slave->direction == I2Cx_READ)){
+		// Mailbox: peek, consumed once the host acknowledged it
+		if(slave->reg == slave->mailbox){
+			if((slave->tx != NULL) && (Ring_Buffer_Filled_Space(slave->tx) > slave->tx_inflight)){
+				I2Cx->DR.REG = Ring_Buffer_Peek_Tail_Offset(slave->tx, slave->tx_inflight++);
+				slave->tx_last_from_queue = 0x01;
+			}
+			// Queue drained: idle bytes are not counted in `tx_inflight`
+			else{
+				I2Cx->DR.REG = I2Cx_SLAVE_IDLE_BYTE;
+				slave->tx_last_from_queue = 0x00;
+			}
+		}
+		// Register File (the last preloaded register is read but NACKed, see `Read_Callback`)
+		else{
+			I2Cx->DR.REG = (slave->Read_Callback != NULL) ? slave->Read_Callback(slave->reg) : I2Cx_SLAVE_IDLE_BYTE;
+			slave->reg++;
+			slave->tx_inflight++;
+		}
+	}
+
+	// STOP detected (EV4): SR1 read above, CR1 write clears STOPF
+	if(SR1 & I2C_SR1_STOPF){
+		I2Cx->CR1.REG |= I2C_CR1_ACK;
+		// End of Transaction
+		if(slave->Stop_Callback != NULL)
+			slave->Stop_Callback(slave->direction);
+	}
+}
+
+/**
+ * @brief Services the I2C Error Interrupt in Slave Mode (AF/BERR/OVR)
+ * @param[in] I2Cx I2C Instance: `I2C1`, `I2C2`
+ * @note AF marks the end of a host read: the byte preloaded in DR is not consumed from `tx`
+ * 		 and the Register Pointer is moved back onto it
+ */
+void I2C_Slave_ER_IRQ_Handler(I2C_REG_STRUCT* I2Cx){
+	// Local Variables
+	i2c_slave_t* slave = i2c_slave[I2C_Slave_Index(I2Cx)];
+	uint32_t SR1 = I2Cx->SR1.REG;
+	// Clear BERR/ARLO/AF/OVR
+	I2C_Clear_Error(I2Cx);
+	// Not in slave mode
+	if(slave == NULL)
+		return;
+	// Host NACKed the last byte (EV3_2)
+	if(SR1 & I2C_SR1_AF){
+		I2C_Slave_TX_Commit(slave);
+		// End of Transaction
+		if(slave->Stop_Callback != NULL)
+			slave->Stop_Callback(I2Cx_READ);
+	}
+	// Misplaced START/STOP: resynchronise on the next ADDR
+	if(SR1 & I2C_SR1_BERR){
+		slave->expect_reg = 0x01;
+		temp = I2Cx->SR2.REG;
+	}
+}
@@ -0,0 +1,126 @@
+// Header Guards
+#ifndef __LOG_H__
+#define __LOG_H__
+
+// Address Mapping
+#include "reg_map.h"
+// USART TX Engine
+#include "usart.h"
+// Framed Telemetry
+#include "usart_frame.h"
+
+/**
+ ** Deferred Binary Logging:
+ * - A log call stores only a record in a RAM word ring: header word + raw argument words (no formatting)
+ * - The format string is placed in the `.log_fmt` section, its address is the Format ID
+ * - `Log_Process()` drains the ring over USART in the background (main loop)
+ *
+ ** Record on the wire: one frame per record (`usart_frame.h`, Type `LOG_FRAME_TYPE`)
+ * 	 |--- Payload: Header `LOG_HEADER(id, level, nargs)` + `nargs` argument words, little endian
+ * 	 |--- The `0x00` delimiter resynchronizes a host joining mid-stream, the CRC rejects corrupted records
+ * 	 |--- Records lost on a full ring are reported as `LOG_ID_DROPPED` with the count as argument,
+ * 	 	  records lost on the wire show up as sequence gaps
+ *
+ ** Linker Script (`stm32f1_ls.ld`): the strings are kept in the ELF only, IDs become offsets from 0
+ * 	 .log_fmt 0 (INFO) : { KEEP(*(.log_fmt*)) }		(after `_end`/`end`, it resets the location counter)
+ * 	 Without it the section is placed in FLASH: IDs are then the low 24 bits of the FLASH address
+ *
+ ** Host Decoding: `tools/log_decode.py main.elf capture.bin` (or `--port /dev/ttyUSB0`)
+ * 	 |--- Format string = NUL terminated string at offset `id - VMA(.log_fmt)` of the `.log_fmt` section
+ * 	 |--- Arguments are applied in order: `%d %i %u %x %X %c %p` take one word, `%s` is not supported
+ * 	 |--- `float` is passed as its bit pattern with `LOG_FLOAT()` and printed with `%f`
+ *
+ ** Cost: with optimization, a call is a PRIMASK section + `nargs + 1` stores (tens of cycles)
+ */
+
+// Argument: `float` bit pattern (integer conversion would truncate it)
+#define LOG_FLOAT(X)						(((union { float f; uint32_t u; }){ .f = (float)(X) }).u)
+
+// Generic Log Call: compile time filtered, `fmt` must be a string literal, up to `LOG_MAX_ARGS` arguments
+#define LOG(level, fmt, ...)																\
+	do{																						\
+		if((level) <= LOG_LEVEL_COMPILE){													\
+			static const char log_fmt[] __attribute__((section(LOG_FMT_SECTION))) = fmt;	\
+			const uint32_t log_args[] = {0, ##__VA_ARGS__};									\
+			Log_Write((level), log_fmt, &log_args[1], (sizeof(log_args) / sizeof(uint32_t)) - 1);	\
+		}																					\
+	} while(0)
+
+// Level Shortcuts
+#define LOG_ERROR(fmt, ...)					LOG(LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)
+#define LOG_WARN(fmt, ...)					LOG(LOG_LEVEL_WARN, fmt, ##__VA_ARGS__)
+#define LOG_INFO(fmt, ...)					LOG(LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)
+#define LOG_DEBUG(fmt, ...)					LOG(LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)
+
+// Log Handle
+typedef struct {
+	// Record Ring (power of 2 words)
+	uint32_t* buffer;
+	// Size of the ring (words)
+	uint16_t size;
+	// Producer Index (log calls)
+	volatile uint16_t head;
+	// Consumer Index (`Log_Process()`)
+	volatile uint16_t tail;
+	// Runtime Level (`LOG_LEVEL_xx`)
+	volatile uint8_t level;
+	// Records lost since the last `LOG_ID_DROPPED` report
+	volatile uint32_t dropped;
+	// USART used by `Log_Process()`
+	usart_config_t* USART_CONFIGx;
+	// TX only Frame Channel (`tx_seq`, `tx_frames` statistics)
+	usart_frame_t frame;
+} log_handle_t;
+
+/**
+ * @brief Initializes the Deferred Log
+ * @param[in] USART_CONFIGx USART Configuration Structure (configured & enabled, IRQ/DMA TX recommended)
+ * @param[in] buffer Record Ring Storage
+ * @param[in] size Number of words (power of 2)
+ * @returns - `0x00`: Failure (No storage/Size not a power of 2/TX Queue smaller than the largest record frame)
+ * @returns - `0x01`: Success
+ * @note IRQ/DMA TX: the TX Queue must hold `USARTx_FRAME_ENCODED_SIZE(LOG_RECORD_MAX_SIZE)` bytes (128 bytes queue)
+ */
+uint8_t Log_Init(usart_config_t* USART_CONFIGx, uint32_t* buffer, uint16_t size);
+
+/**
+ * @brief Stores a log record (safe from any context)
+ * @param[in] level `LOG_LEVEL_ERROR`, `LOG_LEVEL_WARN`, `LOG_LEVEL_INFO`, `LOG_LEVEL_DEBUG`
+ * @param[in] fmt Format String in `.log_fmt` (Format ID)
+ * @param[in] args Argument Words
+ * @param[in] nargs Number of argument words (max `LOG_MAX_ARGS`)
+ * @returns - `0x00`: Not stored (Filtered by level/Ring full)
+ * @returns - `0x01`: Stored
+ * @note Called by the `LOG()` macros
+ */
+uint8_t Log_Write(uint8_t level, const char* fmt, const uint32_t* args, uint8_t nargs);
+
+/**
+ * @brief Drains the log records into the USART TX engine, one frame per record
+ * @returns Number of records handed to the USART
+ * @note - Interrupt/DMA driven TX: only the frames fitting in the TX Queue are moved (never blocks),
+ * 		   the others stay in the ring for the next call
+ * @note - A record whose frame exceeds the whole TX Queue is dropped & counted in `dropped`
+ * @note - Polling TX: every pending record is transmitted
+ */
+uint16_t Log_Process(void);
+
+/**
+ * @brief Sets the runtime log level
+ * @param[in] level `LOG_LEVEL_OFF`, `LOG_LEVEL_ERROR`, `LOG_LEVEL_WARN`, `LOG_LEVEL_INFO`, `LOG_LEVEL_DEBUG`
+ */
+void Log_Set_Level(uint8_t level);
+
+/**
+ * @brief Retrieves the runtime log level
+ * @returns `LOG_LEVEL_OFF`, `LOG_LEVEL_ERROR`, `LOG_LEVEL_WARN`, `LOG_LEVEL_INFO`, `LOG_LEVEL_DEBUG`
+ */
+uint8_t Log_Get_Level(void);
+
+/**
+ * @brief Retrieves the Log Handle (statistics)
+ * @returns Pointer to the Log Handle
+ */
+log_handle_t* Log_Get_Handle(void);
+
+#endif /* __LOG_H__ */
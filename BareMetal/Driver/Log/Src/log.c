@@ -0,0 +1,216 @@
+// Header
+#include "log.h"
+
+// Log Handle
+static log_handle_t log_handle = {.level = LOG_LEVEL_OFF};
+
+/**
+ * @brief Retrieves the number of free words in the Record Ring
+ * @returns Number of free words
+ */
+__STATIC_INLINE__ uint16_t Log_Available_Space(void){
+	// One slot is kept empty (full: head + 1 == tail)
+	return (uint16_t)((log_handle.tail - log_handle.head - 1) & (log_handle.size - 1));
+}
+
+/**
+ * @brief Initializes the Deferred Log
+ * @param[in] USART_CONFIGx USART Configuration Structure (configured & enabled, IRQ/DMA TX recommended)
+ * @param[in] buffer Record Ring Storage
+ * @param[in] size Number of words (power of 2)
+ * @returns - `0x00`: Failure (No storage/Size not a power of 2/TX Queue smaller than the largest record frame)
+ * @returns - `0x01`: Success
+ */
+uint8_t Log_Init(usart_config_t* USART_CONFIGx, uint32_t* buffer, uint16_t size){
+	// Local Variable
+	usart_irq_handle_t* usart = NULL;
+	// Invalid Storage
+	if((USART_CONFIGx == NULL) || (buffer == NULL) || (size < 2) || !Is_Power_Of_2(size))
+		return 0x00;
+	// TX Queue (one slot kept empty) must hold the largest record frame, or it would stall the ring
+	usart = USART_IRQ_Get_Handle(USART_CONFIGx->USARTx);
+	if((usart->tx != NULL) && ((uint32_t)(usart->tx->size - 1) < USARTx_FRAME_ENCODED_SIZE(LOG_RECORD_MAX_SIZE)))
+		return 0x00;
+	// Ring
+	log_handle.buffer = buffer;
+	log_handle.size = size;
+	log_handle.head = 0;
+	log_handle.tail = 0;
+	log_handle.dropped = 0;
+	// Output (TX only Frame Channel)
+	if(!USART_Frame_Init(&log_handle.frame, USART_CONFIGx, NULL, 0, NULL, NULL))
+		return 0x00;
+	log_handle.USART_CONFIGx = USART_CONFIGx;
+	// Everything enabled at compile time is logged
+	log_handle.level = LOG_LEVEL_COMPILE;
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Stores a log record (safe from any context)
+ * @param[in] level `LOG_LEVEL_ERROR`, `LOG_LEVEL_WARN`, `LOG_LEVEL_INFO`, `LOG_LEVEL_DEBUG`
+ * @param[in] fmt Format String in `.log_fmt` (Format ID)
+ * @param[in] args Argument Words
+ * @param[in] nargs Number of argument words (max `LOG_MAX_ARGS`)
+ * @returns - `0x00`: Not stored (Filtered by level/Ring full)
+ * @returns - `0x01`: Stored
+ * @note Called by the `LOG()` macros
+ */
+uint8_t Log_Write(uint8_t level, const char* fmt, const uint32_t* args, uint8_t nargs){
+	// Local Variables
+	uint32_t primask = 0;
+	uint16_t head = 0;
+	uint16_t mask = log_handle.size - 1;
+	// Filtered (also covers the uninitialized log: level OFF)
+	if((level == LOG_LEVEL_OFF) || (level > log_handle.level))
+		return 0x00;
+	// Clamp arguments
+	if(nargs > LOG_MAX_ARGS)
+		nargs = LOG_MAX_ARGS;
+
+	// Producers may be nested (thread + ISRs): reserve & fill atomically
+	primask = __get_PRIMASK();
+	__disable_irq();
+	// Ring full: the whole record is dropped
+	if(Log_Available_Space() < (uint16_t)(nargs + 1)){
+		log_handle.dropped++;
+		__set_PRIMASK(primask);
+		return 0x00;
+	}
+	// Header
+	head = log_handle.head;
+	log_handle.buffer[head] = LOG_HEADER((uint32_t)fmt, level, nargs);
+	head = (head + 1) & mask;
+	// Argument Words
+	while(nargs--){
+		log_handle.buffer[head] = *args++;
+		head = (head + 1) & mask;
+	}
+	// Publish the record
+	log_handle.head = head;
+	__set_PRIMASK(primask);
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Checks that a frame fits in the TX Queue
+ * @param[in] usart USART Handle
+ * @param[in] len Payload length (bytes)
+ * @returns - `0x00`: No room (retry on the next `Log_Process()`)
+ * @returns - `0x01`: Room available (always for Polling TX)
+ */
+__STATIC_INLINE__ uint8_t Log_Frame_Fits(usart_irq_handle_t* usart, uint16_t len){
+	// Polling TX blocks until sent
+	if(usart->tx == NULL)
+		return 0x01;
+	// Worst case encoded size: `USART_Frame_Send()` would drop it otherwise
+	return (Ring_Buffer_Available_Space(usart->tx) >= USARTx_FRAME_ENCODED_SIZE((uint32_t)len));
+}
+
+/**
+ * @brief Checks that a frame can never fit in the TX Queue, even empty
+ * @param[in] usart USART Handle
+ * @param[in] len Payload length (bytes)
+ * @returns - `0x00`: Fits once the queue drains (always for Polling TX)
+ * @returns - `0x01`: Larger than the TX Queue (TX Queue replaced by a smaller one after `Log_Init()`)
+ */
+__STATIC_INLINE__ uint8_t Log_Frame_Too_Large(usart_irq_handle_t* usart, uint16_t len){
+	// Polling TX has no queue
+	if(usart->tx == NULL)
+		return 0x00;
+	// Capacity: one slot is kept empty
+	return ((uint32_t)(usart->tx->size - 1) < USARTx_FRAME_ENCODED_SIZE((uint32_t)len));
+}
+
+/**
+ * @brief Drains the log records into the USART TX engine, one frame per record
+ * @returns Number of records handed to the USART
+ * @note - Interrupt/DMA driven TX: only the frames fitting in the TX Queue are moved (never blocks),
+ * 		   the others stay in the ring for the next call
+ * @note - A record whose frame exceeds the whole TX Queue is dropped & counted in `dropped`
+ * @note - Polling TX: every pending record is transmitted
+ */
+uint16_t Log_Process(void){
+	// Local Variables
+	usart_irq_handle_t* usart = NULL;
+	uint32_t record[LOG_MAX_ARGS + 1] = {0};
+	uint32_t primask = 0;
+	uint16_t mask = log_handle.size - 1;
+	uint16_t tail = 0;
+	uint16_t words = 0;
+	uint16_t i = 0;
+	uint16_t count = 0;
+	// Not initialized
+	if(log_handle.USART_CONFIGx == NULL)
+		return 0;
+	usart = USART_IRQ_Get_Handle(log_handle.USART_CONFIGx->USARTx);
+
+	// Report lost records first (header + count)
+	if(log_handle.dropped && Log_Frame_Fits(usart, 2 * sizeof(uint32_t))){
+		primask = __get_PRIMASK();
+		__disable_irq();
+		record[1] = log_handle.dropped;
+		log_handle.dropped = 0;
+		__set_PRIMASK(primask);
+		record[0] = LOG_HEADER(LOG_ID_DROPPED, LOG_LEVEL_WARN, 1);
+		USART_Frame_Send(&log_handle.frame, LOG_FRAME_TYPE, record, 2 * sizeof(uint32_t));
+		count++;
+	}
+	// Consumer side: only `tail` is updated here, records are published whole by `Log_Write()`
+	while(log_handle.tail != log_handle.head){
+		// Header gives the record length
+		tail = log_handle.tail;
+		record[0] = log_handle.buffer[tail];
+		words = LOG_HEADER_GET_NARGS(record[0]) + 1;
+		// Never fits: drop it (reported as `LOG_ID_DROPPED`) instead of blocking the ring forever
+		if(Log_Frame_Too_Large(usart, words * sizeof(uint32_t))){
+			primask = __get_PRIMASK();
+			__disable_irq();
+			log_handle.dropped++;
+			__set_PRIMASK(primask);
+			log_handle.tail = (tail + words) & mask;
+			continue;
+		}
+		// Keep the record in the ring until its frame fits
+		if(!Log_Frame_Fits(usart, words * sizeof(uint32_t)))
+			break;
+		// Argument Words (the record may wrap around the ring)
+		for(i = 1; i < words; i++)
+			record[i] = log_handle.buffer[(tail + i) & mask];
+		USART_Frame_Send(&log_handle.frame, LOG_FRAME_TYPE, record, words * sizeof(uint32_t));
+		// Release the record
+		log_handle.tail = (tail + words) & mask;
+		count++;
+	}
+	// Records moved
+	return count;
+}
+
+/**
+ * @brief Sets the runtime log level
+ * @param[in] level `LOG_LEVEL_OFF`, `LOG_LEVEL_ERROR`, `LOG_LEVEL_WARN`, `LOG_LEVEL_INFO`, `LOG_LEVEL_DEBUG`
+ */
+void Log_Set_Level(uint8_t level){
+	// Clamp to the compile time level
+	log_handle.level = (level > LOG_LEVEL_COMPILE) ? LOG_LEVEL_COMPILE : level;
+}
+
+/**
+ * @brief Retrieves the runtime log level
+ * @returns `LOG_LEVEL_OFF`, `LOG_LEVEL_ERROR`, `LOG_LEVEL_WARN`, `LOG_LEVEL_INFO`, `LOG_LEVEL_DEBUG`
+ */
+uint8_t Log_Get_Level(void){
+	// Runtime Level
+	return log_handle.level;
+}
+
+/**
+ * @brief Retrieves the Log Handle (statistics)
+ * @returns Pointer to the Log Handle
+ */
+log_handle_t* Log_Get_Handle(void){
+	// Handle
+	return &log_handle;
+}
@@ -16,6 +16,8 @@ typedef struct {
 	uint16_t tail;
     // Size of the buffer
     uint16_t size;
+	// High-water mark (largest fill level seen by `Ring_Buffer_Enqueue()`)
+	uint16_t peak;
 } ring_buffer_t;
 
 /**
@@ -62,6 +64,19 @@ __STATIC_INLINE__ uint16_t Ring_Buffer_Filled_Space(const ring_buffer_t* ring_bu
     return ((ring_buff->head - ring_buff->tail + ring_buff->size) & (ring_buff->size - 1));
 }
 
+/**
+ * @brief Updates the high-water mark of the ring buffer
+ * @param ring_buff Pointer to the ring buffer structure
+ * @note Producers which publish `head` directly (without `Ring_Buffer_Enqueue()`) call this afterwards
+ */
+__STATIC_INLINE__ void Ring_Buffer_Update_Peak(ring_buffer_t* ring_buff){
+	// Local Variable
+	uint16_t filled = Ring_Buffer_Filled_Space(ring_buff);
+	// New maximum
+	if(filled > ring_buff->peak)
+		ring_buff->peak = filled;
+}
+
 /**
  * @brief Peeks the data at the head of the ring buffer 
  * @param ring_buff Pointer to the ring buffer structure
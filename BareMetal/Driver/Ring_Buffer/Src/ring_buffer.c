@@ -33,6 +33,8 @@ uint8_t Ring_Buffer_Enqueue(ring_buffer_t* ring_buff, uint8_t src_data){
 	ring_buff->buffer[ring_buff->head] = src_data;
 	// Update the head index
 	ring_buff->head = ((ring_buff->head + 1) & (ring_buff->size - 1));
+	// Track the high-water mark
+	Ring_Buffer_Update_Peak(ring_buff);
 	// Success
 	return 0x01;
 }
@@ -126,6 +128,7 @@ void Ring_Buffer_Config(ring_buffer_t* ring_buff, uint8_t* buffer, uint16_t size
 	ring_buff->buffer = buffer;
 	ring_buff->head = 0;
 	ring_buff->tail = 0;
+	ring_buff->peak = 0;
 	// Ensure the size is a power of 2
 	if (!Is_Power_Of_2(size)) {
 		size = Round_Up_Power_of_2(size);
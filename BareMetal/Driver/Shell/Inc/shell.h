@@ -0,0 +1,133 @@
+// Header Guards
+#ifndef __SHELL_H__
+#define __SHELL_H__
+
+// Address Mapping
+#include "reg_map.h"
+// USART RX/TX Queues
+#include "usart.h"
+// Runtime Log Level
+#include "log.h"
+// I2C Error Statistics
+#include "i2c.h"
+// PWM Duty Cycle
+#include "pwm.h"
+// Tick Count
+#include "systick.h"
+
+/**
+ ** Command Shell:
+ * - Line oriented, fed by the USART RX Queue: `Shell_Process()` consumes at most `SHELL_RX_BUDGET`
+ * 	 bytes per call and returns, so it can be called from the main loop on every iteration
+ * - RX sources of `Shell_Process()`: the Interrupt RX Queue, otherwise one polled character (RXNE)
+ * 	 |--- DMA RX (`USART_DMA_RX_Init()`) drains DR itself and bypasses both: copy the received spans into
+ * 	 	  a ring buffer from the span callback and feed them to `Shell_Input()` from the main loop
+ * 	 	  (not from the callback: a complete line executes its command in the caller's context)
+ * - Line Editor: Backspace, Ctrl+C (discard), Tab (completion), Up/Down arrows (history)
+ * - Arguments are split on spaces, `"..."` keeps spaces, at most `SHELL_MAX_ARGS` (including the name)
+ * - Commands: the built-in table first, then the user table (static, `const`)
+ *
+ ** Built-in Commands:
+ * 	 |--- `help`: lists the commands
+ * 	 |--- `stats`: ticks, USART queue fill/high-water marks/drops, I2C error counts
+ * 	 |--- `log [off|error|warn|info|debug]`: shows/sets the runtime log level
+ * 	 |--- `pwm <slot> <duty x10>`: updates the duty cycle of an attached PWM output (`Shell_Attach_PWM()`)
+ * 	 |--- `history`: lists the previous lines
+ *
+ * - Output goes through `USART_printf()`: with Interrupt/DMA TX it waits only while the TX Queue is full
+ */
+
+// Forward Declaration
+typedef struct shell shell_t;
+
+// "Shell_Handler_t" is now a type representing:
+// "Pointer to any function taking Shell, Number of arguments, Arguments (argv[0] = command) and returning `SHELL_CMD_OK`/`SHELL_CMD_ERROR`"
+typedef uint8_t (*Shell_Handler_t)(shell_t* shell, uint8_t argc, char* argv[]);
+
+// Shell Command
+typedef struct {
+	// Command Name
+	const char* name;
+	// One line description (`help`)
+	const char* help;
+	// Handler
+	Shell_Handler_t handler;
+} shell_command_t;
+
+// Shell Instance
+struct shell {
+	// USART Configuration Structure
+	usart_config_t* USART_CONFIGx;
+	// User Command Table (may be NULL)
+	const shell_command_t* commands;
+	// Number of user commands
+	uint8_t num_commands;
+	// PWM Outputs for the `pwm` command
+	pwm_handle_t pwm[SHELL_PWM_SLOTS];
+	// User Context
+	void* context;
+
+	// Internal State (managed by the driver)
+	// Line being edited
+	char line[SHELL_LINE_SIZE];
+	// Length of the line
+	uint8_t len;
+	// History (ring of previous lines)
+	char history[SHELL_HISTORY_DEPTH][SHELL_LINE_SIZE];
+	// Next history slot
+	uint8_t history_head;
+	// Stored history lines
+	uint8_t history_count;
+	// History line being recalled (0: none, 1: last line, ...)
+	uint8_t history_index;
+	// Escape Sequence State: `SHELL_ESC_NONE`, `SHELL_ESC_START`, `SHELL_ESC_CSI`
+	uint8_t esc: 2;
+	// Last character was CR (CR LF counts as one line end)
+	uint8_t last_cr: 1;
+};
+
+/**
+ * @brief Initializes the Shell and prints the prompt
+ * @param[in] shell Pointer to the Shell
+ * @param[in] USART_CONFIGx USART Configuration Structure (configured & enabled, Interrupt RX recommended)
+ * @param[in] commands User Command Table (may be NULL)
+ * @param[in] num_commands Number of user commands
+ * @returns - `0x00`: Failure (No Shell/USART)
+ * @returns - `0x01`: Success
+ */
+uint8_t Shell_Init(shell_t* shell, usart_config_t* USART_CONFIGx, const shell_command_t* commands, uint8_t num_commands);
+
+/**
+ * @brief Attaches a PWM Output to a slot of the `pwm` command
+ * @param[in] shell Pointer to the Shell
+ * @param[in] slot Slot (0 - `SHELL_PWM_SLOTS - 1`)
+ * @param[in] PWM_HANDLE PWM Handle (NULL detaches)
+ * @returns - `0x00`: Failure (Invalid slot)
+ * @returns - `0x01`: Success
+ */
+uint8_t Shell_Attach_PWM(shell_t* shell, uint8_t slot, pwm_handle_t PWM_HANDLE);
+
+/**
+ * @brief Processes the received characters (never blocks on RX)
+ * @param[in] shell Pointer to the Shell
+ * @note Call from the main loop, a complete line executes its command from here
+ */
+void Shell_Process(shell_t* shell);
+
+/**
+ * @brief Feeds one character to the line editor
+ * @param[in] shell Pointer to the Shell
+ * @param[in] c Received character
+ */
+void Shell_Input(shell_t* shell, char c);
+
+/**
+ * @brief Tokenizes & executes a command line
+ * @param[in] shell Pointer to the Shell
+ * @param[in] line Command Line (modified in place)
+ * @returns - `SHELL_CMD_ERROR`: Unknown command/Command failed
+ * @returns - `SHELL_CMD_OK`: Success (or empty line)
+ */
+uint8_t Shell_Execute(shell_t* shell, char* line);
+
+#endif /* __SHELL_H__ */
@@ -0,0 +1,461 @@
+// Header
+#include "shell.h"
+
+// Built-in Commands
+static uint8_t Shell_Cmd_Help(shell_t* shell, uint8_t argc, char* argv[]);
+static uint8_t Shell_Cmd_Stats(shell_t* shell, uint8_t argc, char* argv[]);
+static uint8_t Shell_Cmd_Log(shell_t* shell, uint8_t argc, char* argv[]);
+static uint8_t Shell_Cmd_PWM(shell_t* shell, uint8_t argc, char* argv[]);
+static uint8_t Shell_Cmd_History(shell_t* shell, uint8_t argc, char* argv[]);
+
+// Built-in Command Table
+static const shell_command_t shell_builtin[] = {
+	{"help",	"List the commands",								Shell_Cmd_Help},
+	{"stats",	"Ticks, USART queues & I2C errors",					Shell_Cmd_Stats},
+	{"log",		"log [off|error|warn|info|debug]",					Shell_Cmd_Log},
+	{"pwm",		"pwm <slot> <duty x10>",							Shell_Cmd_PWM},
+	{"history",	"List the previous lines",							Shell_Cmd_History},
+};
+#define SHELL_NUM_BUILTIN					(sizeof(shell_builtin) / sizeof(shell_builtin[0]))
+
+// Log Level Names (index = `LOG_LEVEL_xx`)
+static const char* const shell_log_levels[] = {"off", "error", "warn", "info", "debug"};
+
+/**
+ * @brief Retrieves a command by its index (built-in first, then user)
+ * @param[in] shell Pointer to the Shell
+ * @param[in] index Command index
+ * @returns Pointer to the command, NULL past the end
+ */
+static const shell_command_t* Shell_Get_Command(shell_t* shell, uint8_t index){
+	// Built-in
+	if(index < SHELL_NUM_BUILTIN)
+		return &shell_builtin[index];
+	index -= SHELL_NUM_BUILTIN;
+	// User
+	if((shell->commands != NULL) && (index < shell->num_commands))
+		return &shell->commands[index];
+	// End
+	return NULL;
+}
+
+/**
+ * @brief Prints the prompt followed by the line being edited
+ * @param[in] shell Pointer to the Shell
+ */
+static void Shell_Redraw(shell_t* shell){
+	// Start of line + Prompt + Line + Clear to end of line
+	shell->line[shell->len] = '\0';
+	USART_printf(shell->USART_CONFIGx, "\r" SHELL_PROMPT "%s\x1B[K", shell->line);
+}
+
+/**
+ * @brief Stores a line in the history (consecutive duplicates are skipped)
+ * @param[in] shell Pointer to the Shell
+ * @param[in] line Executed line
+ */
+static void Shell_History_Push(shell_t* shell, const char* line){
+	// Local Variable
+	uint8_t last = (shell->history_head + SHELL_HISTORY_DEPTH - 1) % SHELL_HISTORY_DEPTH;
+	// Same as the last one
+	if(shell->history_count && !strcmp(shell->history[last], line))
+		return;
+	// Overwrite the oldest slot
+	strncpy(shell->history[shell->history_head], line, SHELL_LINE_SIZE - 1);
+	shell->history[shell->history_head][SHELL_LINE_SIZE - 1] = '\0';
+	shell->history_head = (shell->history_head + 1) % SHELL_HISTORY_DEPTH;
+	if(shell->history_count < SHELL_HISTORY_DEPTH)
+		shell->history_count++;
+}
+
+/**
+ * @brief Recalls a history line into the line editor
+ * @param[in] shell Pointer to the Shell
+ * @param[in] older `0x01`: Up arrow (older), `0x00`: Down arrow (newer)
+ */
+static void Shell_History_Recall(shell_t* shell, uint8_t older){
+	// Local Variable
+	uint8_t slot = 0;
+	// Move in the history
+	if(older && (shell->history_index < shell->history_count))
+		shell->history_index++;
+	else if(!older && shell->history_index)
+		shell->history_index--;
+	else
+		return;
+	// Back to an empty line
+	if(shell->history_index == 0){
+		shell->len = 0;
+	}
+	else{
+		slot = (shell->history_head + SHELL_HISTORY_DEPTH - shell->history_index) % SHELL_HISTORY_DEPTH;
+		strcpy(shell->line, shell->history[slot]);
+		shell->len = (uint8_t)strlen(shell->line);
+	}
+	// Show it
+	Shell_Redraw(shell);
+}
+
+/**
+ * @brief Completes the command name being typed
+ * @param[in] shell Pointer to the Shell
+ * @note Single match: completed + space, several matches: listed & completed to the common prefix
+ */
+static void Shell_Complete(shell_t* shell){
+	// Local Variables
+	const shell_command_t* command = NULL;
+	const char* first = NULL;
+	uint8_t matches = 0;
+	uint8_t common = 0;
+	uint8_t i = 0;
+	uint8_t j = 0;
+	// Only the command name is completed
+	shell->line[shell->len] = '\0';
+	if(strchr(shell->line, ' ') != NULL)
+		return;
+
+	// Count matches & longest common prefix
+	for(i = 0; (command = Shell_Get_Command(shell, i)) != NULL; i++){
+		if(strncmp(command->name, shell->line, shell->len))
+			continue;
+		if(matches++ == 0){
+			first = command->name;
+			common = (uint8_t)strlen(first);
+		}
+		else{
+			for(j = 0; (j < common) && (first[j] == command->name[j]); j++);
+			common = j;
+		}
+	}
+	// Nothing to complete
+	if(matches == 0)
+		return;
+
+	// Several matches: list them
+	if(matches > 1){
+		USART_puts(shell->USART_CONFIGx, "\r\n");
+		for(i = 0; (command = Shell_Get_Command(shell, i)) != NULL; i++)
+			if(!strncmp(command->name, shell->line, shell->len))
+				USART_printf(shell->USART_CONFIGx, "%s  ", command->name);
+		USART_puts(shell->USART_CONFIGx, "\r\n");
+	}
+	// Extend to the common prefix (+ space on a single match)
+	while((shell->len < common) && (shell->len < (SHELL_LINE_SIZE - 2))){
+		shell->line[shell->len] = first[shell->len];
+		shell->len++;
+	}
+	if(matches == 1)
+		shell->line[shell->len++] = ' ';
+	Shell_Redraw(shell);
+}
+
+/**
+ * @brief Splits a line into arguments (in place)
+ * @param[in] line Command Line
+ * @param[out] argv Arguments
+ * @returns Number of arguments (at most `SHELL_MAX_ARGS`)
+ */
+static uint8_t Shell_Tokenize(char* line, char* argv[]){
+	// Local Variable
+	uint8_t argc = 0;
+	// Arguments
+	while(*line && (argc < SHELL_MAX_ARGS)){
+		// Skip separators
+		while(*line == ' ')
+			*line++ = '\0';
+		if(*line == '\0')
+			break;
+		// Quoted argument
+		if(*line == '"'){
+			argv[argc++] = ++line;
+			while(*line && (*line != '"'))
+				line++;
+		}
+		// Plain argument
+		else{
+			argv[argc++] = line;
+			while(*line && (*line != ' '))
+				line++;
+		}
+		// Terminate the argument
+		if(*line)
+			*line++ = '\0';
+	}
+	// Number of arguments
+	return argc;
+}
+
+/**
+ * @brief Initializes the Shell and prints the prompt
+ * @param[in] shell Pointer to the Shell
+ * @param[in] USART_CONFIGx USART Configuration Structure (configured & enabled, Interrupt RX recommended)
+ * @param[in] commands User Command Table (may be NULL)
+ * @param[in] num_commands Number of user commands
+ * @returns - `0x00`: Failure (No Shell/USART)
+ * @returns - `0x01`: Success
+ */
+uint8_t Shell_Init(shell_t* shell, usart_config_t* USART_CONFIGx, const shell_command_t* commands, uint8_t num_commands){
+	// Invalid Arguments
+	if((shell == NULL) || (USART_CONFIGx == NULL))
+		return 0x00;
+	// Reset State
+	memset(shell, 0, sizeof(shell_t));
+	shell->USART_CONFIGx = USART_CONFIGx;
+	shell->commands = commands;
+	shell->num_commands = (commands != NULL) ? num_commands : 0;
+	// Prompt
+	USART_puts(USART_CONFIGx, "\r\n" SHELL_PROMPT);
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Attaches a PWM Output to a slot of the `pwm` command
+ * @param[in] shell Pointer to the Shell
+ * @param[in] slot Slot (0 - `SHELL_PWM_SLOTS - 1`)
+ * @param[in] PWM_HANDLE PWM Handle (NULL detaches)
+ * @returns - `0x00`: Failure (Invalid slot)
+ * @returns - `0x01`: Success
+ */
+uint8_t Shell_Attach_PWM(shell_t* shell, uint8_t slot, pwm_handle_t PWM_HANDLE){
+	// Invalid slot
+	if(slot >= SHELL_PWM_SLOTS)
+		return 0x00;
+	// Attach
+	shell->pwm[slot] = PWM_HANDLE;
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Processes the received characters (never blocks on RX)
+ * @param[in] shell Pointer to the Shell
+ * @note Call from the main loop, a complete line executes its command from here
+ */
+void Shell_Process(shell_t* shell){
+	// Local Variables
+	USART_REG_STRUCT* USARTx = shell->USART_CONFIGx->USARTx;
+	uint8_t data[SHELL_RX_BUDGET];
+	uint16_t count = 0;
+	uint16_t i = 0;
+	// Interrupt driven RX: drain the RX Queue
+	if(USART_IRQ_Get_Handle(USARTx)->rx != NULL)
+		count = USART_IRQ_Read(shell->USART_CONFIGx, data, SHELL_RX_BUDGET);
+	// Polling RX: one character if present
+	else if(USARTx->SR.REG & USART_SR_RXNE)
+		data[count++] = (uint8_t)USARTx->DR.REG;
+	// Line Editor
+	for(i = 0; i < count; i++)
+		Shell_Input(shell, (char)data[i]);
+}
+
+/**
+ * @brief Feeds one character to the line editor
+ * @param[in] shell Pointer to the Shell
+ * @param[in] c Received character
+ */
+void Shell_Input(shell_t* shell, char c){
+	// Local Variable
+	uint8_t last_cr = shell->last_cr;
+	shell->last_cr = (c == SHELL_KEY_CR);
+
+	// Escape Sequence: ESC [ A (Up) / ESC [ B (Down), others are ignored
+	if(shell->esc == SHELL_ESC_START){
+		shell->esc = (c == '[') ? SHELL_ESC_CSI : SHELL_ESC_NONE;
+		return;
+	}
+	if(shell->esc == SHELL_ESC_CSI){
+		shell->esc = SHELL_ESC_NONE;
+		if((c == 'A') || (c == 'B'))
+			Shell_History_Recall(shell, (c == 'A'));
+		return;
+	}
+
+	switch(c){
+		// Line End (LF right after CR is skipped)
+		case SHELL_KEY_CR:
+		case SHELL_KEY_LF:
+			if((c == SHELL_KEY_LF) && last_cr)
+				return;
+			USART_puts(shell->USART_CONFIGx, "\r\n");
+			shell->line[shell->len] = '\0';
+			if(shell->len){
+				Shell_History_Push(shell, shell->line);
+				Shell_Execute(shell, shell->line);
+			}
+			shell->len = 0;
+			shell->history_index = 0;
+			USART_puts(shell->USART_CONFIGx, SHELL_PROMPT);
+			break;
+		// Erase the last character
+		case SHELL_KEY_BACKSPACE:
+		case SHELL_KEY_DELETE:
+			if(shell->len){
+				shell->len--;
+				USART_puts(shell->USART_CONFIGx, "\b \b");
+			}
+			break;
+		// Completion
+		case SHELL_KEY_TAB:
+			Shell_Complete(shell);
+			break;
+		// Discard the line
+		case SHELL_KEY_CTRL_C:
+			shell->len = 0;
+			shell->history_index = 0;
+			USART_puts(shell->USART_CONFIGx, "^C\r\n" SHELL_PROMPT);
+			break;
+		// Escape Sequence
+		case SHELL_KEY_ESC:
+			shell->esc = SHELL_ESC_START;
+			break;
+		// Printable characters (echoed)
+		default:
+			if((c >= ' ') && (c <= '~') && (shell->len < (SHELL_LINE_SIZE - 1))){
+				shell->line[shell->len++] = c;
+				USART_putc(shell->USART_CONFIGx, c);
+			}
+			break;
+	}
+}
+
+/**
+ * @brief Tokenizes & executes a command line
+ * @param[in] shell Pointer to the Shell
+ * @param[in] line Command Line (modified in place)
+ * @returns - `SHELL_CMD_ERROR`: Unknown command/Command failed
+ * @returns - `SHELL_CMD_OK`: Success (or empty line)
+ */
+uint8_t Shell_Execute(shell_t* shell, char* line){
+	// Local Variables
+	const shell_command_t* command = NULL;
+	char* argv[SHELL_MAX_ARGS];
+	uint8_t argc = Shell_Tokenize(line, argv);
+	uint8_t i = 0;
+	// Empty line
+	if(argc == 0)
+		return SHELL_CMD_OK;
+	// Look up the command
+	for(i = 0; (command = Shell_Get_Command(shell, i)) != NULL; i++){
+		if(!strcmp(command->name, argv[0])){
+			if(command->handler(shell, argc, argv) == SHELL_CMD_OK)
+				return SHELL_CMD_OK;
+			USART_printf(shell->USART_CONFIGx, "%s: failed (usage: %s)\r\n", argv[0], command->help);
+			return SHELL_CMD_ERROR;
+		}
+	}
+	// Unknown
+	USART_printf(shell->USART_CONFIGx, "%s: unknown command (try 'help')\r\n", argv[0]);
+	return SHELL_CMD_ERROR;
+}
+
+/**
+ * @brief `help`: lists the commands
+ */
+static uint8_t Shell_Cmd_Help(shell_t* shell, uint8_t argc, char* argv[]){
+	// Local Variables
+	const shell_command_t* command = NULL;
+	uint8_t i = 0;
+	// Name + Description
+	for(i = 0; (command = Shell_Get_Command(shell, i)) != NULL; i++)
+		USART_printf(shell->USART_CONFIGx, "%-10s %s\r\n", command->name, command->help);
+	// Success
+	return SHELL_CMD_OK;
+}
+
+/**
+ * @brief `stats`: ticks, USART queue fill/high-water marks/drops, I2C error counts
+ */
+static uint8_t Shell_Cmd_Stats(shell_t* shell, uint8_t argc, char* argv[]){
+	// Local Variables
+	USART_REG_STRUCT* const usart[3] = {USART1, USART2, USART3};
+	I2C_REG_STRUCT* const i2c[2] = {I2C1, I2C2};
+	usart_irq_handle_t* handle = NULL;
+	i2c_error_stats_t* errors = NULL;
+	uint8_t i = 0;
+	// Ticks (low 32 bits)
+	USART_printf(shell->USART_CONFIGx, "ticks    %lu\r\n", (uint32_t)SysTick_Get_Ticks());
+	// USART Queues: fill/peak/size
+	for(i = 0; i < 3; i++){
+		handle = USART_IRQ_Get_Handle(usart[i]);
+		if((handle->tx == NULL) && (handle->rx == NULL))
+			continue;
+		USART_printf(shell->USART_CONFIGx, "usart%u   ", i + 1);
+		if(handle->tx != NULL)
+			USART_printf(shell->USART_CONFIGx, "tx %u/%u/%u  ", Ring_Buffer_Filled_Space(handle->tx), handle->tx->peak, handle->tx->size);
+		if(handle->rx != NULL)
+			USART_printf(shell->USART_CONFIGx, "rx %u/%u/%u  ", Ring_Buffer_Filled_Space(handle->rx), handle->rx->peak, handle->rx->size);
+		USART_printf(shell->USART_CONFIGx, "dropped %lu errors %lu\r\n", handle->rx_dropped, handle->rx_errors);
+	}
+	// I2C Errors
+	for(i = 0; i < 2; i++){
+		errors = I2C_Get_Error_Stats(i2c[i]);
+		USART_printf(shell->USART_CONFIGx, "i2c%u     berr %lu arlo %lu af %lu ovr %lu timeout %lu\r\n",
+					 i + 1, errors->berr, errors->arlo, errors->af, errors->ovr, errors->timeout);
+	}
+	// Log
+	USART_printf(shell->USART_CONFIGx, "log      dropped %lu\r\n", Log_Get_Handle()->dropped);
+	// Success
+	return SHELL_CMD_OK;
+}
+
+/**
+ * @brief `log [off|error|warn|info|debug]`: shows/sets the runtime log level
+ */
+static uint8_t Shell_Cmd_Log(shell_t* shell, uint8_t argc, char* argv[]){
+	// Local Variable
+	uint8_t level = 0;
+	// Set
+	if(argc > 1){
+		for(level = LOG_LEVEL_OFF; level <= LOG_LEVEL_DEBUG; level++)
+			if(!strcmp(argv[1], shell_log_levels[level]))
+				break;
+		if(level > LOG_LEVEL_DEBUG)
+			return SHELL_CMD_ERROR;
+		Log_Set_Level(level);
+	}
+	// Show (clamped to `LOG_LEVEL_COMPILE`)
+	USART_printf(shell->USART_CONFIGx, "log level: %s\r\n", shell_log_levels[Log_Get_Level()]);
+	// Success
+	return SHELL_CMD_OK;
+}
+
+/**
+ * @brief `pwm <slot> <duty x10>`: updates the duty cycle of an attached PWM output
+ */
+static uint8_t Shell_Cmd_PWM(shell_t* shell, uint8_t argc, char* argv[]){
+	// Local Variables
+	char* end = NULL;
+	long slot = 0;
+	long duty = 0;
+	// Arguments
+	if(argc != 3)
+		return SHELL_CMD_ERROR;
+	slot = strtol(argv[1], &end, 10);
+	if((*end != '\0') || (slot < 0) || (slot >= SHELL_PWM_SLOTS) || (shell->pwm[slot] == NULL))
+		return SHELL_CMD_ERROR;
+	duty = strtol(argv[2], &end, 10);
+	if((*end != '\0') || (duty < 0) || (duty > 1000))
+		return SHELL_CMD_ERROR;
+	// Update
+	PWM_Update_Duty_Cycle(shell->pwm[slot], (int16_t)duty);
+	USART_printf(shell->USART_CONFIGx, "pwm%ld duty %ld.%ld%%\r\n", slot, duty / 10, duty % 10);
+	// Success
+	return SHELL_CMD_OK;
+}
+
+/**
+ * @brief `history`: lists the previous lines (oldest first)
+ */
+static uint8_t Shell_Cmd_History(shell_t* shell, uint8_t argc, char* argv[]){
+	// Local Variables
+	uint8_t i = 0;
+	uint8_t slot = 0;
+	// Oldest first
+	for(i = shell->history_count; i > 0; i--){
+		slot = (shell->history_head + SHELL_HISTORY_DEPTH - i) % SHELL_HISTORY_DEPTH;
+		USART_printf(shell->USART_CONFIGx, "%u  %s\r\n", shell->history_count - i + 1, shell->history[slot]);
+	}
+	// Success
+	return SHELL_CMD_OK;
+}
@@ -0,0 +1,188 @@
+// Header Guards
+#ifndef __TIMER_CAPTURE_H__
+#define __TIMER_CAPTURE_H__
+
+// Address Mapping
+#include "reg_map.h"
+// Time Base & Timer Clock
+#include "timer.h"
+// Circular Double Buffer
+#include "dma_stream.h"
+
+/**
+ ** Timer Input Capture:
+ * - The counter runs free over 16 bits (`TIMx_IC_ARR`) at `tick_Hz`, a valid edge latches CNT into CCRx
+ * - Input stage per channel: TIx -> filter (`ICxF`) -> edge detector (`CCxP`) -> selection (`CCxS`)
+ * 	 -> prescaler (`ICxPSC`, one capture every 1/2/4/8 edges) -> CCRx
+ * - Modes:
+ * 	 |--- `TIMx_IC_MODE_EDGE`: one channel, CCRx holds the timestamp of the last edge, periods are the
+ * 	 	  differences of consecutive timestamps (modulo 2^16, valid for periods below 65536 ticks)
+ * 	 |--- `TIMx_IC_MODE_PWM_INPUT`: TI1 feeds IC1 (`polarity` edge) and IC2 (opposite edge), TI1FP1 resets
+ * 	 	  the counter (slave reset mode): CCR1 = period, CCR2 = active time, both in ticks
+ * - DMA (`buffer` != NULL): captures are moved without CPU work into a circular double buffer
+ * 	 |--- Edge: CCRx on every capture, the callback gets the timestamps of the finished half
+ * 	 |--- PWM Input: burst of CCR1 & CCR2 (`DCR`/`DMAR`) on every IC1 capture, the callback gets
+ * 	 	  `{period, active}` pairs
+ * - DMA Requests: TIM2 CH1-CH4, TIM3 CH1/CH3/CH4, TIM4 CH1-CH3 (TIM3_CH2 & TIM4_CH4 have none)
+ * - The input pin must be configured as floating/pulled input by the caller
+ */
+
+// Forward Declaration
+typedef struct timer_capture timer_capture_t;
+
+// "TIM_Capture_Callback_t" is now a type representing:
+// "Pointer to any function taking Timer Capture, Captures of the finished half, Number of captures and returning void"
+typedef void (*TIM_Capture_Callback_t)(timer_capture_t* capture, const uint16_t* data, uint16_t count);
+
+// Timer Input Capture (storage owned by the client while capturing)
+struct timer_capture {
+	// General Purpose Timer
+	// - `TIM2`
+	// - `TIM3`
+	// - `TIM4`
+	TIM_REG_STRUCT* TIM;
+	// Capture Channel (`TIMx_CHANNEL_1` for `TIMx_IC_MODE_PWM_INPUT`)
+	// - `TIMx_CHANNEL_1`
+	// - `TIMx_CHANNEL_2`
+	// - `TIMx_CHANNEL_3`
+	// - `TIMx_CHANNEL_4`
+	uint8_t channel;
+	// Capture Mode
+	// - `TIMx_IC_MODE_EDGE`
+	// - `TIMx_IC_MODE_PWM_INPUT`
+	uint8_t mode: 1;
+	// Input Selection (Edge Mode, PWM Input always uses TI1)
+	// - `TIMx_IC_SEL_DIRECT`
+	// - `TIMx_IC_SEL_INDIRECT`
+	// - `TIMx_IC_SEL_TRC`
+	uint8_t selection: 2;
+	// Capture Edge (PWM Input: start of the period)
+	// - `TIMx_IC_POL_RISING`
+	// - `TIMx_IC_POL_FALLING`
+	uint8_t polarity: 1;
+	// Input Prescaler `TIMx_IC_PSC_DIV_x` (PWM Input: `TIMx_IC_PSC_DIV_1`, the counter is reset on every edge)
+	uint8_t prescaler: 2;
+	// Input Filter `TIMx_IC_FILTER_xx`
+	uint8_t filter: 4;
+	// Counter Frequency (in Hz), Timer Clock / 65536 - Timer Clock
+	uint32_t tick_Hz;
+	// DMA Double Buffer (NULL: no DMA, read the captures with `TIM_Capture_Get()`/`TIM_Capture_PWM_Read()`)
+	uint16_t* buffer;
+	// Number of items in `buffer` (Edge: even, >= 2; PWM Input: multiple of 4, two items per capture)
+	uint16_t count;
+	// Half Processing Callback (executed in interrupt context)
+	TIM_Capture_Callback_t callback;
+	// User Context
+	void* context;
+
+	// Internal State (managed by the driver)
+	// Achieved Counter Frequency (in Hz)
+	uint32_t actual_tick_Hz;
+	// Circular DMA (`overrun`/`errors` statistics)
+	dma_stream_t dma;
+};
+
+/**
+ * @brief Converts a Timer Channel into its index
+ * @param[in] channel `TIMx_CHANNEL_1`, `TIMx_CHANNEL_2`, `TIMx_CHANNEL_3`, `TIMx_CHANNEL_4`
+ * @returns Channel index (0 - 3)
+ */
+__STATIC_INLINE__ uint8_t TIM_Capture_Channel_Index(uint8_t channel){
+	// Lowest channel set
+	if(channel & TIMx_CHANNEL_1)
+		return 0;
+	else if(channel & TIMx_CHANNEL_2)
+		return 1;
+	else if(channel & TIMx_CHANNEL_3)
+		return 2;
+	return 3;
+}
+
+/**
+ * @brief Retrieves the last captured counter value
+ * @param[in] TIMx `TIM2`, `TIM3`, `TIM4`
+ * @param[in] channel `TIMx_CHANNEL_1`, `TIMx_CHANNEL_2`, `TIMx_CHANNEL_3`, `TIMx_CHANNEL_4`
+ * @returns Captured value (reading clears the channel capture flag)
+ */
+__STATIC_INLINE__ uint16_t TIM_Capture_Get(TIM_REG_STRUCT* TIMx, uint8_t channel){
+	// CCR1 - CCR4 are consecutive
+	return (uint16_t)((&TIMx->CCR1.CC1_IN)[TIM_Capture_Channel_Index(channel)]);
+}
+
+/**
+ * @brief Converts a number of ticks into a frequency
+ * @param[in] capture Pointer to the Timer Capture
+ * @param[in] period_ticks Period (in ticks)
+ * @returns Frequency (in Hz, rounded), 0 for a zero period
+ */
+__STATIC_INLINE__ uint32_t TIM_Capture_Get_Frequency_Hz(const timer_capture_t* capture, uint32_t period_ticks){
+	// No signal
+	if(period_ticks == 0)
+		return 0;
+	// Rounded to nearest
+	return (capture->actual_tick_Hz + (period_ticks >> 1)) / period_ticks;
+}
+
+/**
+ * @brief Converts a number of ticks into microseconds
+ * @param[in] capture Pointer to the Timer Capture
+ * @param[in] ticks Duration (in ticks)
+ * @returns Duration (in us)
+ */
+__STATIC_INLINE__ uint32_t TIM_Capture_Get_Time_us(const timer_capture_t* capture, uint32_t ticks){
+	// 64-bit product: 65535 ticks x 10^6 overflows 32 bits
+	return (uint32_t)(((uint64_t)ticks * 1000000U) / capture->actual_tick_Hz);
+}
+
+/**
+ * @brief Computes the Duty Cycle of a PWM Input capture
+ * @param[in] active_ticks Active time (in ticks)
+ * @param[in] period_ticks Period (in ticks)
+ * @returns Duty Cycle (%) x 10 (0 - 1000, same scale as `PWM_Update_Duty_Cycle()`)
+ */
+__STATIC_INLINE__ uint16_t TIM_Capture_Get_Duty_Cycle(uint16_t active_ticks, uint16_t period_ticks){
+	// No signal
+	if(period_ticks == 0)
+		return 0;
+	// Active time cannot exceed the period
+	if(active_ticks >= period_ticks)
+		return 1000;
+	// Rounded to nearest
+	return (uint16_t)((((uint32_t)active_ticks * 1000U) + (period_ticks >> 1)) / period_ticks);
+}
+
+/**
+ * @brief Configures the Timer & Capture Channel(s) and starts capturing
+ * @param[in] capture Pointer to the Timer Capture (must stay valid while capturing)
+ * @returns - `0x00`: Failure (Invalid Timer/Channel/Mode/Tick rate/count/No DMA Request for the channel/DMA Channel busy)
+ * @returns - `0x01`: Success
+ * @note The Timer is reconfigured (PSC/ARR/SMCR/CCMR/CCER), it must not be shared with another function
+ */
+uint8_t TIM_Capture_Start(timer_capture_t* capture);
+
+/**
+ * @brief Stops capturing, the counter & the DMA stream
+ * @param[in] capture Pointer to the Timer Capture
+ */
+void TIM_Capture_Stop(timer_capture_t* capture);
+
+/**
+ * @brief Reads the last PWM Input measurement
+ * @param[in] capture Pointer to the Timer Capture (`TIMx_IC_MODE_PWM_INPUT`)
+ * @param[out] period_ticks Period (in ticks)
+ * @param[out] active_ticks Active time (in ticks)
+ * @returns - `0x00`: Failure (No complete period captured yet/Counter overflowed: signal slower than `tick_Hz` / 65536)
+ * @returns - `0x01`: Success
+ */
+uint8_t TIM_Capture_PWM_Read(timer_capture_t* capture, uint16_t* period_ticks, uint16_t* active_ticks);
+
+/**
+ * @brief Converts Edge Mode timestamps into periods
+ * @param[in] stamps Timestamps
+ * @param[in] count Number of timestamps
+ * @param[in] previous Last timestamp of the previous block, updated with the last timestamp of this block
+ * @param[out] periods Periods (in ticks, may alias `stamps`)
+ */
+void TIM_Capture_Timestamps_To_Periods(const uint16_t* stamps, uint16_t count, uint16_t* previous, uint16_t* periods);
+
+#endif /* __TIMER_CAPTURE_H__ */
@@ -0,0 +1,269 @@
+// Header
+#include "timer_capture.h"
+
+// Capture DMA Channels: [0] -> TIM2, [1] -> TIM3, [2] -> TIM4 / [x][0] -> CH1, ..., [x][3] -> CH4
+static DMA_CHANNEL_REG_STRUCT* const TIM_Capture_DMA_Channel[3][4] = {
+	{DMA_TIM2_CH1, DMA_TIM2_CH2, DMA_TIM2_CH3, DMA_TIM2_CH4},
+	{DMA_TIM3_CH1, NULL, DMA_TIM3_CH3, DMA_TIM3_CH4},
+	{DMA_TIM4_CH1, DMA_TIM4_CH2, DMA_TIM4_CH3, NULL}
+};
+
+// Capture DMA Requests: same layout as `TIM_Capture_DMA_Channel`
+static const uint8_t TIM_Capture_DMA_Request[3][4] = {
+	{DMAx_REQ_TIM2_CH1, DMAx_REQ_TIM2_CH2, DMAx_REQ_TIM2_CH3, DMAx_REQ_TIM2_CH4},
+	{DMAx_REQ_TIM3_CH1, DMAx_REQ_NONE, DMAx_REQ_TIM3_CH3, DMAx_REQ_TIM3_CH4},
+	{DMAx_REQ_TIM4_CH1, DMAx_REQ_TIM4_CH2, DMAx_REQ_TIM4_CH3, DMAx_REQ_NONE}
+};
+
+/**
+ * @brief Converts a General Purpose Timer into its table index
+ * @param[in] TIMx `TIM2`, `TIM3`, `TIM4`
+ * @returns Timer index (0 - 2), 0xFF for any other timer
+ */
+static uint8_t TIM_Capture_Timer_Index(TIM_REG_STRUCT* TIMx){
+	// General Purpose Timers only
+	if(TIMx == TIM2)
+		return 0;
+	else if(TIMx == TIM3)
+		return 1;
+	else if(TIMx == TIM4)
+		return 2;
+	return 0xFF;
+}
+
+/**
+ * @brief Programs the input stage of one Capture Channel
+ * @param[in] TIMx `TIM2`, `TIM3`, `TIM4`
+ * @param[in] index Channel index (0 - 3)
+ * @param[in] selection `TIMx_IC_SEL_DIRECT`, `TIMx_IC_SEL_INDIRECT`, `TIMx_IC_SEL_TRC`
+ * @param[in] polarity `TIMx_IC_POL_RISING`, `TIMx_IC_POL_FALLING`
+ * @param[in] prescaler `TIMx_IC_PSC_DIV_x`
+ * @param[in] filter `TIMx_IC_FILTER_xx`
+ * @note The channel is left enabled (`CCxE`)
+ */
+static void TIM_Capture_Channel_Config(TIM_REG_STRUCT* TIMx, uint8_t index, uint8_t selection,
+									   uint8_t polarity, uint8_t prescaler, uint8_t filter){
+	// Local Variables
+	volatile uint32_t* ccmr = (index < 2) ? &TIMx->CCMR1.REG : &TIMx->CCMR2.REG;
+	uint8_t ccmr_shift = (index & 0x01) * 8;
+	uint8_t ccer_shift = index * 4;
+	// CCxS is writable only with the channel off
+	TIMx->CCER.REG &= ~((uint32_t)(TIM_CCER_CC1E | TIM_CCER_CC1P) << ccer_shift);
+	// CCxS[1:0], ICxPSC[3:2], ICxF[7:4]
+	*ccmr &= ~((uint32_t)0xFF << ccmr_shift);
+	*ccmr |= ((uint32_t)(((filter & 0x0F) << TIM_CCMR1_IC1F_Pos) | \
+						 ((prescaler & 0x03) << TIM_CCMR1_IC1PSC_Pos) | \
+						 ((selection & 0x03) << TIM_CCMR1_CC1S_Pos)) << ccmr_shift);
+	// Edge & Capture Enable
+	TIMx->CCER.REG |= ((uint32_t)(((polarity & 0x01) ? TIM_CCER_CC1P : 0) | TIM_CCER_CC1E) << ccer_shift);
+}
+
+/**
+ * @brief DMA Stream Half Callback: hands the finished captures to the client
+ * @param[in] dma DMA Stream
+ * @param[in] half Pointer to the finished half
+ * @param[in] count Number of items in the half
+ */
+static void TIM_Capture_Half_Callback(dma_stream_t* dma, void* half, uint16_t count){
+	// Local Variable
+	timer_capture_t* capture = (timer_capture_t *)dma->context;
+	// PWM Input: two items per capture
+	if(capture->mode == TIMx_IC_MODE_PWM_INPUT)
+		count >>= 1;
+	// Notify
+	if(capture->callback != NULL)
+		capture->callback(capture, (const uint16_t *)half, count);
+}
+
+/**
+ * @brief Starts the Capture DMA stream
+ * @param[in] capture Pointer to the Timer Capture
+ * @param[in] timer Timer index (0 - 2)
+ * @param[in] index Channel index (0 - 3)
+ * @returns - `0x00`: Failure (No DMA Request for the channel/Invalid count/DMA Channel busy)
+ * @returns - `0x01`: Success
+ */
+static uint8_t TIM_Capture_DMA_Start(timer_capture_t* capture, uint8_t timer, uint8_t index){
+	// Local Variable
+	TIM_REG_STRUCT* TIMx = capture->TIM;
+	// TIM3_CH2 & TIM4_CH4 have no DMA Request
+	if(TIM_Capture_DMA_Request[timer][index] == DMAx_REQ_NONE)
+		return 0x00;
+	// PWM Input: whole `{period, active}` pairs in each half
+	if((capture->mode == TIMx_IC_MODE_PWM_INPUT) && (capture->count & 0x03))
+		return 0x00;
+
+	// Circular Double Buffer: CCRx (Edge) or DMAR burst of CCR1 & CCR2 (PWM Input) -> buffer
+	capture->dma.DMA_Channel = TIM_Capture_DMA_Channel[timer][index];
+	capture->dma.request = TIM_Capture_DMA_Request[timer][index];
+	capture->dma.direction = DMAx_DIR_READ_PER;
+	capture->dma.priority = DMAx_PRIORITY_HIGH;
+	capture->dma.perDataSize = DMAx_DATA_SIZE_BIT_16;
+	capture->dma.memDataSize = DMAx_DATA_SIZE_BIT_16;
+	if(capture->mode == TIMx_IC_MODE_PWM_INPUT)
+		capture->dma.peripheral = (volatile void *)&TIMx->DMAR;
+	else
+		capture->dma.peripheral = (volatile void *)&(&TIMx->CCR1.CC1_IN)[index];
+	capture->dma.buffer = capture->buffer;
+	capture->dma.count = capture->count;
+	capture->dma.callback = TIM_Capture_Half_Callback;
+	capture->dma.context = capture;
+	if(!DMA_Stream_Start(&capture->dma))
+		return 0x00;
+
+	// PWM Input: each IC1 request reads CCR1 then CCR2 through DMAR
+	if(capture->mode == TIMx_IC_MODE_PWM_INPUT)
+		TIMx->DCR.REG = ((uint32_t)TIMx_IC_DBL_2_TRANSFERS << TIM_DCR_DBL_Pos) | \
+						((uint32_t)TIMx_IC_DBA_CCR1 << TIM_DCR_DBA_Pos);
+	// Capture/Compare DMA Request
+	TIMx->DIER.REG |= (TIM_DIER_CC1DE << index);
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Configures the Timer & Capture Channel(s) and starts capturing
+ * @param[in] capture Pointer to the Timer Capture (must stay valid while capturing)
+ * @returns - `0x00`: Failure (Invalid Timer/Channel/Mode/Tick rate/count/No DMA Request for the channel/DMA Channel busy)
+ * @returns - `0x01`: Success
+ * @note The Timer is reconfigured (PSC/ARR/SMCR/CCMR/CCER), it must not be shared with another function
+ */
+uint8_t TIM_Capture_Start(timer_capture_t* capture){
+	// Local Variables
+	timer_config_t TIMx_CONFIG = {0};
+	TIM_REG_STRUCT* TIMx = NULL;
+	uint32_t timer_freq_Hz = 0;
+	uint32_t prescaler = 0;
+	uint8_t timer = 0;
+	uint8_t index = 0;
+	uint8_t opposite = TIMx_IC_POL_RISING;
+	// Invalid Arguments
+	if((capture == NULL) || (capture->tick_Hz == 0))
+		return 0x00;
+	TIMx = capture->TIM;
+	timer = TIM_Capture_Timer_Index(TIMx);
+	if(timer == 0xFF)
+		return 0x00;
+	// Exactly one channel
+	if((capture->channel == 0) || (capture->channel & ~TIMx_CHANNEL_ALL) || (capture->channel & (capture->channel - 1)))
+		return 0x00;
+	// PWM Input pairs CC1 & CC2 on TI1
+	if((capture->mode == TIMx_IC_MODE_PWM_INPUT) && (capture->channel != TIMx_CHANNEL_1))
+		return 0x00;
+	if((capture->mode == TIMx_IC_MODE_EDGE) && (capture->selection == 0))
+		return 0x00;
+	index = TIM_Capture_Channel_Index(capture->channel);
+	// Counter Prescaler (16 bits)
+	timer_freq_Hz = TIM_Get_Frequency(TIMx);
+	if(capture->tick_Hz > timer_freq_Hz)
+		return 0x00;
+	prescaler = (timer_freq_Hz / capture->tick_Hz) - 1;
+	if(prescaler > 0xFFFF)
+		return 0x00;
+
+	// Free running Time Base (also resets CCMR/CCER/SMCR/DIER)
+	TIMx_CONFIG.TIM = TIMx;
+	TIMx_CONFIG.auto_reload = TIMx_IC_ARR;
+	TIMx_CONFIG.prescaler = prescaler;
+	TIMx_CONFIG.count = TIMx_DEFAULT_CNT;
+	TIMx_CONFIG.cms_mode = TIMx_CMS_EDGE;
+	TIMx_CONFIG.direction = TIMx_DIR_COUNT_UP;
+	TIMx_CONFIG.arpe = TIMx_ARPE_DISABLE;
+	TIMx_CONFIG.one_pulse = TIMx_OPM_DISABLE;
+	TIM_Config(&TIMx_CONFIG);
+	capture->actual_tick_Hz = timer_freq_Hz / (prescaler + 1);
+
+	if(capture->mode == TIMx_IC_MODE_PWM_INPUT){
+		// IC1: TI1 on the period edge -> CCR1 = period
+		TIM_Capture_Channel_Config(TIMx, 0, TIMx_IC_SEL_DIRECT, capture->polarity, TIMx_IC_PSC_DIV_1, capture->filter);
+		// IC2: TI1 on the opposite edge -> CCR2 = active time
+		opposite = (capture->polarity == TIMx_IC_POL_RISING) ? TIMx_IC_POL_FALLING : TIMx_IC_POL_RISING;
+		TIM_Capture_Channel_Config(TIMx, 1, TIMx_IC_SEL_INDIRECT, opposite, TIMx_IC_PSC_DIV_1, capture->filter);
+		// TI1FP1 resets the counter at the start of every period
+		TIMx->SMCR.REG &= ~(TIM_SMCR_TS_Msk | TIM_SMCR_SMS_Msk);
+		TIMx->SMCR.REG |= ((uint32_t)TIMx_TS_TI1FP1 << TIM_SMCR_TS_Pos) | \
+						  ((uint32_t)TIMx_SMS_RESET << TIM_SMCR_SMS_Pos);
+		// Only a counter overflow sets UIF (signal lost/slower than `tick_Hz` / 65536)
+		TIMx->CR1.REG |= TIM_CR1_URS;
+	}
+	else{
+		// Single channel timestamps
+		TIM_Capture_Channel_Config(TIMx, index, capture->selection, capture->polarity, capture->prescaler, capture->filter);
+	}
+
+	// Captures moved by the DMA
+	if(capture->buffer != NULL){
+		if(!TIM_Capture_DMA_Start(capture, timer, index)){
+			TIM_Capture_Stop(capture);
+			return 0x00;
+		}
+	}
+	// Start Counting
+	TIM_Enable(TIMx);
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Stops capturing, the counter & the DMA stream
+ * @param[in] capture Pointer to the Timer Capture
+ */
+void TIM_Capture_Stop(timer_capture_t* capture){
+	// Local Variable
+	TIM_REG_STRUCT* TIMx = capture->TIM;
+	// Stop Counting
+	TIM_Disable(TIMx);
+	// Capture DMA Requests & Burst
+	TIMx->DIER.REG &= ~(TIM_DIER_CC1DE | TIM_DIER_CC2DE | TIM_DIER_CC3DE | TIM_DIER_CC4DE);
+	TIMx->DCR.REG = 0;
+	// Capture Channels & Slave Mode
+	TIMx->CCER.REG &= ~(TIM_CCER_CC1E | TIM_CCER_CC2E | TIM_CCER_CC3E | TIM_CCER_CC4E);
+	TIMx->SMCR.REG &= ~(TIM_SMCR_TS_Msk | TIM_SMCR_SMS_Msk);
+	// Release the Channel
+	if(capture->dma.running)
+		DMA_Stream_Stop(&capture->dma);
+}
+
+/**
+ * @brief Reads the last PWM Input measurement
+ * @param[in] capture Pointer to the Timer Capture (`TIMx_IC_MODE_PWM_INPUT`)
+ * @param[out] period_ticks Period (in ticks)
+ * @param[out] active_ticks Active time (in ticks)
+ * @returns - `0x00`: Failure (No complete period captured yet/Counter overflowed: signal slower than `tick_Hz` / 65536)
+ * @returns - `0x01`: Success
+ */
+uint8_t TIM_Capture_PWM_Read(timer_capture_t* capture, uint16_t* period_ticks, uint16_t* active_ticks){
+	// Local Variable
+	TIM_REG_STRUCT* TIMx = capture->TIM;
+	// Counter overflow since the last read: the captured period is not valid
+	if(TIMx->SR.REG & TIM_SR_UIF){
+		TIMx->SR.REG &= ~TIM_SR_UIF;
+		return 0x00;
+	}
+	// CCR2 belongs to the period in CCR1 until the next IC2 edge (a DMA burst always reads a matching pair)
+	*period_ticks = (uint16_t)TIMx->CCR1.CC1_IN;
+	*active_ticks = (uint16_t)TIMx->CCR2.CC2_IN;
+	// No complete period yet
+	return (*period_ticks != 0);
+}
+
+/**
+ * @brief Converts Edge Mode timestamps into periods
+ * @param[in] stamps Timestamps
+ * @param[in] count Number of timestamps
+ * @param[in] previous Last timestamp of the previous block, updated with the last timestamp of this block
+ * @param[out] periods Periods (in ticks, may alias `stamps`)
+ */
+void TIM_Capture_Timestamps_To_Periods(const uint16_t* stamps, uint16_t count, uint16_t* previous, uint16_t* periods){
+	// Local Variables
+	uint16_t last = *previous;
+	uint16_t stamp = 0;
+	while(count--){
+		stamp = *stamps++;
+		// Modulo 2^16: a counter wrap between the two edges cancels out
+		*periods++ = (uint16_t)(stamp - last);
+		last = stamp;
+	}
+	// Next block continues from here
+	*previous = last;
+}
@@ -15,6 +15,8 @@
 #include "gpio.h"
 // NVIC Enable
 #include "nvic.h"
+// Interrupt driven TX/RX Queues
+#include "ring_buffer.h"
 // va_list
 #include <stdarg.h>
 /*************************************** Dependency ********************************************/
@@ -42,8 +44,8 @@ typedef struct {
 	gpio_config_t TX;
 	// RX Configuration
 	gpio_config_t RX;
-	// Baud Rate
-	uint16_t baud_rate;
+	// Baud Rate (in baud): `USARTx_BAUD_xx`, up to f_PCLK / 16
+	uint32_t baud_rate;
 	// Stop Bits
 	uint8_t stop_bits;
 	// Word Length
@@ -65,6 +67,26 @@ typedef struct {
 } usart_config_t;
 /*************************************** USART Configuration Structure ********************************************/
 
+/*************************************** USART Interrupt Handle ********************************************/
+// USART Interrupt Driven Handle
+typedef struct {
+	// TX Queue (`NULL`: Polling TX)
+	ring_buffer_t* tx;
+	// RX Queue (`NULL`: Polling RX)
+	ring_buffer_t* rx;
+	// TX in progress (queue draining or last frame still shifting out)
+	volatile uint8_t tx_active;
+	// TX Queue drained by DMA (`USART_DMA_TX_Init()`)
+	uint8_t tx_dma: 1;
+	// Bytes of the TX Queue currently owned by the DMA
+	volatile uint16_t tx_dma_len;
+	// Bytes dropped because `rx` was full
+	volatile uint32_t rx_dropped;
+	// Receive Errors (Overrun/Framing/Noise/Parity)
+	volatile uint32_t rx_errors;
+} usart_irq_handle_t;
+/*************************************** USART Interrupt Handle ********************************************/
+
 /*************************************** USART1 ********************************************/
 // Configuration Structure (Interrupt Disabled)
 static usart_config_t USART1_Configuration = {
@@ -154,12 +176,69 @@ __STATIC_INLINE__ uint8_t USART_get_IRQn(USART_REG_STRUCT* USARTx){
 		return USART3_IRQn;
 }
 
+/**
+ * @brief Retrieves the Index of USART
+ * @param[in] USARTx USART Instance: `USART1`, `USART2`, `USART3`
+ * @returns `0` for `USART1`, `1` for `USART2`, `2` for `USART3`
+ */
+__STATIC_INLINE__ uint8_t USART_get_index(USART_REG_STRUCT* USARTx){
+	// USART1: Index 0, USART2: Index 1, USART3: Index 2
+	return (USARTx == USART1) ? 0 : ((USARTx == USART2) ? 1 : 2);
+}
+
+/**
+ * @brief Retrieves the Kernel Clock of USART
+ * @param[in] USARTx USART Instance: `USART1`, `USART2`, `USART3`
+ * @returns APB2 Clock (`USART1`), APB1 Clock (`USART2`, `USART3`) in Hz
+ */
+__STATIC_INLINE__ uint32_t USART_get_clock(USART_REG_STRUCT* USARTx){
+	// USART1 on APB2, USART2/USART3 on APB1
+	return (USARTx == USART1) ? RCC_Get_APB2Clock() : RCC_Get_APB1Clock();
+}
+
 /**
  * @brief Initialises USART based upon input Configuration Structure
  * @param[in] USART_CONFIGx USART Configuration Structure
  */
 void USART_Config(usart_config_t* USART_CONFIGx);
 
+/**
+ * @brief Computes the Baud Rate Register value from the live APB Clock
+ * @param[in] USARTx USART Instance: `USART1`, `USART2`, `USART3`
+ * @param[in] baud_rate Requested Baud Rate (in baud)
+ * @returns BRR (Mantissa[15:4] + Fraction[3:0]) rounded to nearest, clamped to `USARTx_BRR_MIN` - `USARTx_BRR_MAX`
+ * @note - Reference results (SYSCLK 72MHz: APB2 = 72MHz for `USART1`, APB1 = 36MHz for `USART2`/`USART3`):
+ * |-----------|-----------------|-----------------|
+ * | Requested | USART1 (72MHz)  | USART2/3 (36MHz)|
+ * |           | BRR    | Error  | BRR    | Error  |
+ * |-----------|--------|--------|--------|--------|
+ * | 9600      | 0x1D4C | 0.00%  | 0x0EA6 | 0.00%  |
+ * | 115200    | 0x0271 | 0.00%  | 0x0139 | -0.16% |
+ * | 230400    | 0x0139 | -0.16% | 0x009C | +0.16% |
+ * | 460800    | 0x009C | +0.16% | 0x004E | +0.16% |
+ * | 921600    | 0x004E | +0.16% | 0x0027 | +0.16% |
+ * | 2000000   | 0x0024 | 0.00%  | 0x0012 | 0.00%  |
+ * | 2250000   | 0x0020 | 0.00%  | 0x0010 | 0.00%  |
+ * | 4500000   | 0x0010 | 0.00%  | N/A    | N/A    |
+ * |-----------|--------|--------|--------|--------|
+ */
+uint16_t USART_Compute_BRR(USART_REG_STRUCT* USARTx, uint32_t baud_rate);
+
+/**
+ * @brief Retrieves the Baud Rate achieved with the programmed BRR
+ * @param[in] USART_CONFIGx USART Configuration Structure (configured)
+ * @returns Achieved Baud Rate (in baud)
+ */
+uint32_t USART_Get_Baud_Rate(usart_config_t* USART_CONFIGx);
+
+/**
+ * @brief Retrieves the error between the achieved and the requested Baud Rate
+ * @param[in] USART_CONFIGx USART Configuration Structure (configured)
+ * @returns Signed error in 0.01% (e.g. `-16` -> -0.16%)
+ * @note Receivers typically tolerate up to ~2% total error (both sides) with 16x oversampling
+ */
+int32_t USART_Get_Baud_Error(usart_config_t* USART_CONFIGx);
+
 /**
  * @brief Transmits a character on USART
  * @param[in] USART_CONFIGx USART Configuration Structure
@@ -207,11 +286,42 @@ __STATIC_INLINE__ void sep(usart_config_t* USART_CONFIGx, char c, uint8_t length
 	USART_putc(USART_CONFIGx, '\n');
 }
 
+/**
+ * @brief Formats data into a buffer (no allocation, single pass)
+ * @param[out] buffer Destination (always '\0' terminated)
+ * @param[in] size Size of the destination
+ * @param[in] format The formatted string
+ * @param[in] args Arguments
+ * @returns Number of characters written (excluding '\0'), output is truncated to `size - 1`
+ */
+uint16_t USART_vsnprintf(char* buffer, uint16_t size, const char* format, va_list args);
+
+/**
+ * @brief Formats data into a buffer (no allocation, single pass)
+ * @param[out] buffer Destination (always '\0' terminated)
+ * @param[in] size Size of the destination
+ * @param[in] format The formatted string
+ * @returns Number of characters written (excluding '\0'), output is truncated to `size - 1`
+ */
+uint16_t USART_snprintf(char* buffer, uint16_t size, const char* format, ...);
+
+/**
+ * @brief Transmits a buffer on USART in one operation
+ * @param[in] USART_CONFIGx USART Configuration Structure
+ * @param[in] data Pointer to the data
+ * @param[in] len Number of bytes
+ * @note - Interrupt/DMA driven TX: queued at once, waits only while the TX Queue is full
+ * @note - Polling TX: transmitted byte by byte
+ */
+void USART_Write(usart_config_t* USART_CONFIGx, const uint8_t* data, uint16_t len);
+
 /**
  * @brief Transmits formatted data on USART
  * @param[in] USART_CONFIGx USART Configuration Structure
  * @param[in] format The formatted string
- * @note `float` decimal restricted max to 6 places
+ * @note - Rendered into a `USARTx_PRINTF_BUFFER_SIZE` stack buffer, then handed to the TX engine at once
+ * @note - Supports `%c %s %d %i %u %x %X %p %f %%`, flags `- 0 + space`, width, precision & `l`/`h` length
+ * @note - `float` uses `USARTx_PRINTF_FLOAT_PRECISION` decimals by default, max `USARTx_PRINTF_FLOAT_PRECISION_MAX`
  */
 void USART_printf(usart_config_t* USART_CONFIGx, const char* format, ...);
 
@@ -269,6 +379,68 @@ __STATIC_INLINE__ void USART_DMA_RX_Disable(USART_REG_STRUCT* USARTx){
 	USARTx->CR3.REG &= ~USART_CR3_DMAR;
 }
 
+/**
+ * @brief Switches USART to Interrupt driven TX/RX
+ * @param[in] USART_CONFIGx USART Configuration Structure (configured & enabled)
+ * @param[in] tx TX Queue (may be NULL to keep polling TX)
+ * @param[in] rx RX Queue (may be NULL to keep polling RX)
+ * @note - `USART_putc()`, `USART_puts()` & `USART_printf()` return once the data is queued
+ * @note - `USART_receive()` reads from `rx`
+ * @note - `USARTx_IRQHandler()` services RXNE (-> `rx`), TXE (<- `tx`) & TC (end of transmission)
+ */
+void USART_IRQ_Init(usart_config_t* USART_CONFIGx, ring_buffer_t* tx, ring_buffer_t* rx);
+
+/**
+ * @brief Switches USART back to Polling TX/RX
+ * @param[in] USART_CONFIGx USART Configuration Structure
+ * @note Pending TX data is flushed first
+ */
+void USART_IRQ_DeInit(usart_config_t* USART_CONFIGx);
+
+/**
+ * @brief Queues data for Interrupt driven transmission
+ * @param[in] USART_CONFIGx USART Configuration Structure
+ * @param[in] data Pointer to the data
+ * @param[in] len Number of bytes
+ * @returns Number of bytes queued (less than `len` if the TX Queue is full)
+ */
+uint16_t USART_IRQ_Write(usart_config_t* USART_CONFIGx, const uint8_t* data, uint16_t len);
+
+/**
+ * @brief Starts/Continues the transmission of the TX Queue
+ * @param[in] USART_CONFIGx USART Configuration Structure
+ * @note Producers that write directly into the TX Queue storage (e.g. framing encoders) call this after publishing `head`
+ */
+void USART_IRQ_TX_Commit(usart_config_t* USART_CONFIGx);
+
+/**
+ * @brief Reads the data received by the Interrupt driven reception
+ * @param[in] USART_CONFIGx USART Configuration Structure
+ * @param[out] data Pointer to the destination buffer
+ * @param[in] len Maximum number of bytes
+ * @returns Number of bytes read
+ */
+uint16_t USART_IRQ_Read(usart_config_t* USART_CONFIGx, uint8_t* data, uint16_t len);
+
+/**
+ * @brief Waits until the TX Queue is drained and the last frame is shifted out
+ * @param[in] USART_CONFIGx USART Configuration Structure
+ */
+void USART_IRQ_Flush(usart_config_t* USART_CONFIGx);
+
+/**
+ * @brief Retrieves the Interrupt Handle of USART (queues & statistics)
+ * @param[in] USARTx USART Instance: `USART1`, `USART2`, `USART3`
+ * @returns Pointer to the USART Interrupt Handle
+ */
+usart_irq_handle_t* USART_IRQ_Get_Handle(USART_REG_STRUCT* USARTx);
+
+/**
+ * @brief Services the USART Interrupt (RXNE/IDLE/TXE/TC)
+ * @param[in] USARTx USART Instance: `USART1`, `USART2`, `USART3`
+ */
+void USART_IRQ_Handler(USART_REG_STRUCT* USARTx);
+
 /**
  * @brief Appends the data to the USART TX buffer
  * @param str The sequence of characters (string) to be appended
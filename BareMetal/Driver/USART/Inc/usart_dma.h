@@ -0,0 +1,156 @@
+// Header Guards
+#ifndef __USART_DMA_H__
+#define __USART_DMA_H__
+
+// Address Mapping
+#include "reg_map.h"
+// USART Configuration & Interrupt Handle
+#include "usart.h"
+// DMA Channel Manager
+#include "dma.h"
+// Circular DMA Reception
+#include "dma_stream.h"
+
+/**
+ ** DMA TX Path:
+ * - The TX Queue (`ring_buffer_t`) is transmitted in place: the DMA reads the contiguous span
+ * 	 [tail, head) or [tail, end of storage), no staging copy is made
+ * - The TC callback consumes the span (`tail` advances) and re-arms the next span while data remains
+ * - The last frame is tracked by the USART TC Interrupt, so `USART_IRQ_Flush()` keeps working
+ * - The DMA Channel is allocated per burst: if it is owned by another request (e.g. `I2C2` TX on
+ * 	 Channel 4) the burst falls back to the TXE Interrupt and DMA is retried on the next burst
+ *
+ ** DMA RX Path:
+ * - The DMA fills a circular buffer continuously (no byte-level interrupts)
+ * - New data is delivered as (pointer, length) spans on:
+ * 	 |--- IDLE: the line went idle for one frame -> end of a packet
+ * 	 |--- HT/TC: the buffer is half/completely filled -> long bursts are delivered before they are overwritten
+ * - A span never crosses the end of the buffer: wrapped data is delivered as two spans
+ * - The callback must consume (or copy) the span before the DMA wraps onto it again
+ */
+
+// "USART_RX_Callback_t" is now a type representing:
+// "Pointer to any function taking USART Instance, Pointer to received data, Number of bytes and returning void"
+typedef void (*USART_RX_Callback_t)(USART_REG_STRUCT* USARTx, const uint8_t* data, uint16_t len);
+
+/**
+ * @brief Retrieves the TX DMA Channel of USART
+ * @param[in] USARTx USART Instance: `USART1`, `USART2`, `USART3`
+ * @returns `DMA_USART1_TX` (DMA1 Channel 4), `DMA_USART2_TX` (DMA1 Channel 7), `DMA_USART3_TX` (DMA1 Channel 2)
+ */
+__STATIC_INLINE__ DMA_CHANNEL_REG_STRUCT* USART_DMA_Get_TX_Channel(USART_REG_STRUCT* USARTx){
+	// USART1
+	if(USARTx == USART1)
+		return DMA_USART1_TX;
+	// USART2
+	else if(USARTx == USART2)
+		return DMA_USART2_TX;
+	// USART3
+	else
+		return DMA_USART3_TX;
+}
+
+/**
+ * @brief Retrieves the TX DMA Request of USART
+ * @param[in] USARTx USART Instance: `USART1`, `USART2`, `USART3`
+ * @returns `DMAx_REQ_USART1_TX`, `DMAx_REQ_USART2_TX`, `DMAx_REQ_USART3_TX`
+ */
+__STATIC_INLINE__ uint8_t USART_DMA_Get_TX_Request(USART_REG_STRUCT* USARTx){
+	// USART1
+	if(USARTx == USART1)
+		return DMAx_REQ_USART1_TX;
+	// USART2
+	else if(USARTx == USART2)
+		return DMAx_REQ_USART2_TX;
+	// USART3
+	else
+		return DMAx_REQ_USART3_TX;
+}
+
+/**
+ * @brief Retrieves the RX DMA Channel of USART
+ * @param[in] USARTx USART Instance: `USART1`, `USART2`, `USART3`
+ * @returns `DMA_USART1_RX` (DMA1 Channel 5), `DMA_USART2_RX` (DMA1 Channel 6), `DMA_USART3_RX` (DMA1 Channel 3)
+ */
+__STATIC_INLINE__ DMA_CHANNEL_REG_STRUCT* USART_DMA_Get_RX_Channel(USART_REG_STRUCT* USARTx){
+	// USART1
+	if(USARTx == USART1)
+		return DMA_USART1_RX;
+	// USART2
+	else if(USARTx == USART2)
+		return DMA_USART2_RX;
+	// USART3
+	else
+		return DMA_USART3_RX;
+}
+
+/**
+ * @brief Retrieves the RX DMA Request of USART
+ * @param[in] USARTx USART Instance: `USART1`, `USART2`, `USART3`
+ * @returns `DMAx_REQ_USART1_RX`, `DMAx_REQ_USART2_RX`, `DMAx_REQ_USART3_RX`
+ */
+__STATIC_INLINE__ uint8_t USART_DMA_Get_RX_Request(USART_REG_STRUCT* USARTx){
+	// USART1
+	if(USARTx == USART1)
+		return DMAx_REQ_USART1_RX;
+	// USART2
+	else if(USARTx == USART2)
+		return DMAx_REQ_USART2_RX;
+	// USART3
+	else
+		return DMAx_REQ_USART3_RX;
+}
+
+/**
+ * @brief Switches the USART TX to the DMA Path
+ * @param[in] USART_CONFIGx USART Configuration Structure (configured & enabled)
+ * @param[in] tx TX Queue
+ * @returns - `0x00`: Failure (No TX Queue)
+ * @returns - `0x01`: Success
+ * @note The RX Queue attached by `USART_IRQ_Init()` is kept
+ */
+uint8_t USART_DMA_TX_Init(usart_config_t* USART_CONFIGx, ring_buffer_t* tx);
+
+/**
+ * @brief Queues data and transmits it through DMA
+ * @param[in] USART_CONFIGx USART Configuration Structure
+ * @param[in] data Pointer to the data
+ * @param[in] len Number of bytes
+ * @returns Number of bytes queued (less than `len` if the TX Queue is full)
+ */
+uint16_t USART_Write_DMA(usart_config_t* USART_CONFIGx, const uint8_t* data, uint16_t len);
+
+/**
+ * @brief Starts the DMA on the next contiguous span of the TX Queue (if idle)
+ * @param[in] USARTx USART Instance: `USART1`, `USART2`, `USART3`
+ * @returns - `0x00`: DMA not running (Queue empty/Channel owned by another request/TXE Interrupt draining)
+ * @returns - `0x01`: DMA running
+ * @note Producers that enqueue directly into the TX Queue call this to start the transmission
+ */
+uint8_t USART_DMA_TX_Kick(USART_REG_STRUCT* USARTx);
+
+/**
+ * @brief Starts the circular DMA Reception with IDLE line detection
+ * @param[in] USART_CONFIGx USART Configuration Structure (configured & enabled)
+ * @param[in] buffer Circular Buffer (must stay valid while receiving)
+ * @param[in] size Size of the buffer (even)
+ * @param[in] callback Called with every received span (executed in interrupt context)
+ * @returns - `0x00`: Failure (Odd/Zero size/No callback/DMA Channel owned by another request)
+ * @returns - `0x01`: Success
+ * @note The RXNE Interrupt is disabled: `USART_receive()`/`USART_IRQ_Read()` are not used in this mode
+ */
+uint8_t USART_DMA_RX_Init(usart_config_t* USART_CONFIGx, uint8_t* buffer, uint16_t size, USART_RX_Callback_t callback);
+
+/**
+ * @brief Stops the circular DMA Reception and releases its DMA Channel
+ * @param[in] USART_CONFIGx USART Configuration Structure
+ */
+void USART_DMA_RX_DeInit(usart_config_t* USART_CONFIGx);
+
+/**
+ * @brief Delivers the data received since the last span (called on IDLE, HT & TC)
+ * @param[in] USARTx USART Instance: `USART1`, `USART2`, `USART3`
+ */
+void USART_DMA_RX_Flush(USART_REG_STRUCT* USARTx);
+
+#endif /* __USART_DMA_H__ */
@@ -0,0 +1,125 @@
+// Header Guards
+#ifndef __USART_FRAME_H__
+#define __USART_FRAME_H__
+
+// Address Mapping
+#include "reg_map.h"
+// USART TX Engine
+#include "usart.h"
+
+/**
+ ** Framed Binary Telemetry:
+ * - Frame = COBS( Type | Sequence | Payload | CRC16 (little endian) ) + `0x00` Delimiter
+ * - CRC16-CCITT (poly `0x1021`, init `0xFFFF`, no reflection) over Type, Sequence & Payload
+ * - COBS removes every `0x00` from the frame, so `0x00` always marks a frame boundary:
+ * 	 a receiver joining mid-stream resynchronizes on the next delimiter
+ * - Overhead: 5 bytes + 1 byte per 254 bytes (`USARTx_FRAME_ENCODED_SIZE()`)
+ *
+ ** TX (Streaming Encoder):
+ * - Interrupt/DMA driven TX: the frame is encoded straight into the TX Queue storage and published
+ * 	 at once (`head` moves after the last byte), then `USART_IRQ_TX_Commit()` starts the transmission
+ * - A frame which does not fit in the TX Queue is dropped whole (`tx_dropped`), never truncated
+ * - Polling TX: the frame is encoded byte by byte into `USART_putc()`
+ * - The TX Queue has a single producer: do not send frames & `USART_printf()` from different contexts
+ *
+ ** RX (Incremental Decoder):
+ * - `USART_Frame_Decode()` consumes arbitrary chunks, e.g. the spans of the DMA RX callback:
+ * 	 void RX_Callback(USART_REG_STRUCT* USARTx, const uint8_t* data, uint16_t len){
+ * 		 USART_Frame_Decode(&telemetry, data, len);
+ * 	 }
+ * - Valid frames are delivered from the decoder context with Type, Sequence & Payload
+ * - Sequence gaps (lost frames) are counted, CRC/COBS/Overflow errors drop the frame
+ *
+ ** Host Decoding (`tools/frame_decode.py`, reference decoder & round trip tests in `tools/test_frame_decode.py`):
+ * 	 split the stream on `0x00`, COBS decode, check the CRC16 over all but the last two bytes,
+ * 	 then byte 0 = Type, byte 1 = Sequence, remaining = Payload
+ */
+
+// Forward Declaration
+typedef struct usart_frame usart_frame_t;
+
+// "USART_Frame_Callback_t" is now a type representing:
+// "Pointer to any function taking Frame Channel, Type, Sequence, Pointer to Payload, Payload length and returning void"
+typedef void (*USART_Frame_Callback_t)(usart_frame_t* frame, uint8_t type, uint8_t seq, const uint8_t* payload, uint16_t len);
+
+// Framed Telemetry Channel
+struct usart_frame {
+	// USART Configuration Structure
+	usart_config_t* USART_CONFIGx;
+	// Decoded Frame Storage (Header + Payload + CRC)
+	uint8_t* rx_buffer;
+	// Size of the decoded frame storage
+	uint16_t rx_size;
+	// Frame Callback (may be NULL)
+	USART_Frame_Callback_t callback;
+	// User Context
+	void* context;
+
+	// Internal State (managed by the driver)
+	// Next TX Sequence
+	uint8_t tx_seq;
+	// Expected RX Sequence
+	uint8_t rx_seq;
+	// RX Sequence valid (first frame received)
+	uint8_t rx_seq_valid: 1;
+	// Decoded bytes are lost (frame too large)
+	uint8_t rx_overflow: 1;
+	// A zero is due before the next COBS block
+	uint8_t rx_zero: 1;
+	// Bytes left in the current COBS block
+	uint8_t rx_remaining;
+	// Decoded bytes
+	uint16_t rx_len;
+
+	// Statistics
+	uint32_t tx_frames;
+	uint32_t tx_dropped;
+	uint32_t rx_frames;
+	uint32_t rx_crc_errors;
+	uint32_t rx_framing_errors;
+	uint32_t rx_seq_gaps;
+};
+
+/**
+ * @brief Computes the CRC16-CCITT (poly `0x1021`)
+ * @param[in] crc Initial value (`USARTx_FRAME_CRC_INIT`) or running CRC
+ * @param[in] data Pointer to the data
+ * @param[in] len Number of bytes
+ * @returns Updated CRC
+ */
+uint16_t USART_Frame_CRC16(uint16_t crc, const uint8_t* data, uint16_t len);
+
+/**
+ * @brief Initializes a Framed Telemetry Channel
+ * @param[in] frame Pointer to the Frame Channel
+ * @param[in] USART_CONFIGx USART Configuration Structure (configured & enabled)
+ * @param[in] rx_buffer Decoded Frame Storage (largest payload + 4 bytes), may be NULL for TX only
+ * @param[in] rx_size Size of the decoded frame storage
+ * @param[in] callback Frame Callback (may be NULL)
+ * @param[in] context User Context
+ * @returns - `0x00`: Failure (No USART/Storage smaller than an empty frame)
+ * @returns - `0x01`: Success
+ */
+uint8_t USART_Frame_Init(usart_frame_t* frame, usart_config_t* USART_CONFIGx, uint8_t* rx_buffer, uint16_t rx_size, USART_Frame_Callback_t callback, void* context);
+
+/**
+ * @brief Encodes & transmits a frame
+ * @param[in] frame Pointer to the Frame Channel
+ * @param[in] type Message Type ID
+ * @param[in] payload Pointer to the payload (may be NULL if `len` is 0)
+ * @param[in] len Payload length
+ * @returns - `0x00`: Failure (Frame does not fit in the TX Queue, dropped)
+ * @returns - `0x01`: Success
+ */
+uint8_t USART_Frame_Send(usart_frame_t* frame, uint8_t type, const void* payload, uint16_t len);
+
+/**
+ * @brief Feeds received bytes to the incremental decoder
+ * @param[in] frame Pointer to the Frame Channel
+ * @param[in] data Pointer to the received bytes
+ * @param[in] len Number of bytes
+ * @note The Frame Callback is called from here for every valid frame
+ */
+void USART_Frame_Decode(usart_frame_t* frame, const uint8_t* data, uint16_t len);
+
+#endif /* __USART_FRAME_H__ */
@@ -6,6 +6,11 @@
 
 // Dependency
 #include "usart.h"
+// DMA TX Path
+#include "usart_dma.h"
+
+// USART Interrupt Handles: [0] -> `USART1`, [1] -> `USART2`, [2] -> `USART3`
+static usart_irq_handle_t usart_irq_handle[3] = {0};
 
 /**
  * @brief Initialises USART based upon input Configuration Structure
@@ -17,11 +22,8 @@ void USART_Config(usart_config_t* USART_CONFIGx){
 	GPIO_Config(&USART_CONFIGx->RX);
 	// Enable USART Clock
 	USART_clk_enable(USART_CONFIGx);
-	// Configure Baud Rate
-	if(USART_CONFIGx->USARTx == USART1)
-		USART_CONFIGx->USARTx->BRR.REG = (uint32_t)(RCC_Get_APB2Clock()/(USART_CONFIGx->baud_rate));
-	else
-		USART_CONFIGx->USARTx->BRR.REG = (uint32_t)(RCC_Get_APB1Clock()/(USART_CONFIGx->baud_rate));
+	// Configure Baud Rate (live APB2/APB1 Clock, rounded to nearest)
+	USART_CONFIGx->USARTx->BRR.REG = USART_Compute_BRR(USART_CONFIGx->USARTx, USART_CONFIGx->baud_rate);
 	// Configure Stop Bits
 	USART_CONFIGx->USARTx->CR2.REG |= ((USART_CONFIGx->stop_bits & 0x03) << USART_CR2_STOP_Pos);
 	// Configure Rest of the Parameters
@@ -29,7 +31,7 @@ void USART_Config(usart_config_t* USART_CONFIGx){
 									   ((USART_CONFIGx->enable_parity & 0x01) << USART_CR1_PCE_Pos) | 
 									   ((USART_CONFIGx->parity_selection & 0x01) << USART_CR1_PS_Pos) | 
 									   ((USART_CONFIGx->TXEIE & 0x01) << USART_CR1_TXEIE_Pos) | 
-									   ((USART_CONFIGx->TCIE & 0x01) << USART_CR1_TXEIE_Pos) | 
+									   ((USART_CONFIGx->TCIE & 0x01) << USART_CR1_TCIE_Pos) | 
 									   ((USART_CONFIGx->RXNEIE & 0x01) << USART_CR1_RXNEIE_Pos) | 
 									   ((USART_CONFIGx->TXE & 0x01) << USART_CR1_TE_Pos) | 
 									   ((USART_CONFIGx->RXE & 0x01) << USART_CR1_RE_Pos));
@@ -38,12 +40,73 @@ void USART_Config(usart_config_t* USART_CONFIGx){
 		NVIC_IRQ_Enable(USART_get_IRQn(USART_CONFIGx->USARTx));
 }
 
+/**
+ * @brief Computes the Baud Rate Register value from the live APB Clock
+ * @param[in] USARTx USART Instance: `USART1`, `USART2`, `USART3`
+ * @param[in] baud_rate Requested Baud Rate (in baud)
+ * @returns BRR (Mantissa[15:4] + Fraction[3:0]) rounded to nearest, clamped to `USARTx_BRR_MIN` - `USARTx_BRR_MAX`
+ */
+uint16_t USART_Compute_BRR(USART_REG_STRUCT* USARTx, uint32_t baud_rate){
+	// Local Variables
+	uint32_t clock = USART_get_clock(USARTx);
+	uint32_t brr = USARTx_BRR_MAX;
+	// 16 * USARTDIV = f_PCLK / baud: Fraction carries into the Mantissa on its own
+	if(baud_rate)
+		brr = (clock + (baud_rate >> 1)) / baud_rate;
+	// USARTDIV >= 1 (Max: f_PCLK / 16), Mantissa is 12 bits
+	if(brr < USARTx_BRR_MIN)
+		brr = USARTx_BRR_MIN;
+	else if(brr > USARTx_BRR_MAX)
+		brr = USARTx_BRR_MAX;
+	// BRR
+	return (uint16_t)brr;
+}
+
+/**
+ * @brief Retrieves the Baud Rate achieved with the programmed BRR
+ * @param[in] USART_CONFIGx USART Configuration Structure (configured)
+ * @returns Achieved Baud Rate (in baud)
+ */
+uint32_t USART_Get_Baud_Rate(usart_config_t* USART_CONFIGx){
+	// Local Variable
+	uint32_t brr = USART_CONFIGx->USARTx->BRR.REG & 0xFFFF;
+	// Not configured
+	if(brr == 0)
+		return 0;
+	// f_PCLK / (16 * USARTDIV), rounded to nearest
+	return (USART_get_clock(USART_CONFIGx->USARTx) + (brr >> 1)) / brr;
+}
+
+/**
+ * @brief Retrieves the error between the achieved and the requested Baud Rate
+ * @param[in] USART_CONFIGx USART Configuration Structure (configured)
+ * @returns Signed error in 0.01% (e.g. `-16` -> -0.16%)
+ * @note Receivers typically tolerate up to ~2% total error (both sides) with 16x oversampling
+ */
+int32_t USART_Get_Baud_Error(usart_config_t* USART_CONFIGx){
+	// Local Variables
+	int64_t requested = (int64_t)USART_CONFIGx->baud_rate;
+	int64_t achieved = (int64_t)USART_Get_Baud_Rate(USART_CONFIGx);
+	// Nothing requested
+	if(requested == 0)
+		return 0;
+	// (achieved - requested) / requested in 0.01%
+	return (int32_t)(((achieved - requested) * 10000) / requested);
+}
+
 /**
  * @brief Transmits a character on USART
  * @param[in] USART_CONFIGx USART Configuration Structure
  * @param[in] c The character to be transmitted
  */
 void USART_putc(usart_config_t* USART_CONFIGx, const char c){
+	// Local Handle
+	usart_irq_handle_t* handle = &usart_irq_handle[USART_get_index(USART_CONFIGx->USARTx)];
+	// Interrupt driven TX: wait only while the queue is full
+	if(handle->tx != NULL){
+		while(!USART_IRQ_Write(USART_CONFIGx, (const uint8_t *)&c, 1));
+		return;
+	}
 	// Wait for TX to be Empty
 	while (!(USART_CONFIGx->USARTx->SR.REG & USART_SR_TXE_Msk));
 	// Transfer the data 
@@ -77,146 +140,337 @@ void USART_puts(usart_config_t* USART_CONFIGx, const char* str){
 		USART_putc(USART_CONFIGx, *str);
 		// Update the pointer to next position
 		str++;
-		// Delay
-		for(volatile uint16_t local_delay = 0; local_delay < USARTx_STRING_TX_DELAY; local_delay++);
+		// Delay (Polling TX only)
+		if(usart_irq_handle[USART_get_index(USART_CONFIGx->USARTx)].tx == NULL)
+			for(volatile uint16_t local_delay = 0; local_delay < USARTx_STRING_TX_DELAY; local_delay++);
 	}
 }
 
+// Formatted Output Buffer
+typedef struct {
+	// Destination
+	char* buffer;
+	// Size of the destination (including '\0')
+	uint16_t size;
+	// Characters written (excluding '\0')
+	uint16_t len;
+} usart_format_t;
+
+// Powers of 10 for the fixed-point `float` conversion
+static const uint32_t usart_pow10[USARTx_PRINTF_FLOAT_PRECISION_MAX + 1] = {
+	1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
 /**
- * @brief Transmits formatted data on USART
- * @param[in] USART_CONFIGx USART Configuration Structure
+ * @brief Appends a character to the Formatted Output (dropped once the buffer is full)
+ * @param[in] out Formatted Output Buffer
+ * @param[in] c Character
+ */
+__STATIC_INLINE__ void USART_Format_Putc(usart_format_t* out, char c){
+	// Keep room for '\0'
+	if((out->len + 1) < out->size)
+		out->buffer[out->len++] = c;
+}
+
+/**
+ * @brief Converts an unsigned integer to digits
+ * @param[out] digits Destination (at least 11 characters for base 10, 8 for base 16)
+ * @param[in] value Value
+ * @param[in] base `10`, `16`
+ * @param[in] upper `0x00`: 'a'-'f', `0x01`: 'A'-'F'
+ * @returns Number of digits
+ */
+static uint8_t USART_Format_Utoa(char* digits, uint32_t value, uint8_t base, uint8_t upper){
+	// Local Variables
+	char reversed[10];
+	uint8_t count = 0;
+	uint8_t i = 0;
+	uint8_t digit = 0;
+	// Least significant digit first
+	do{
+		digit = (base == 16) ? (value & 0x0F) : (value % 10);
+		reversed[count++] = (digit < 10) ? ('0' + digit) : ((upper ? 'A' : 'a') + digit - 10);
+		value = (base == 16) ? (value >> 4) : (value / 10);
+	} while(value);
+	// Most significant digit first
+	for(i = 0; i < count; i++)
+		digits[i] = reversed[count - 1 - i];
+	// Number of digits
+	return count;
+}
+
+/**
+ * @brief Appends a field padded to `width`
+ * @param[in] out Formatted Output Buffer
+ * @param[in] sign Sign/Prefix character (`'\0'` for none)
+ * @param[in] str Field characters
+ * @param[in] len Number of field characters
+ * @param[in] width Minimum field width
+ * @param[in] flags `USARTx_FORMAT_FLAG_LEFT`, `USARTx_FORMAT_FLAG_ZERO`
+ */
+static void USART_Format_Field(usart_format_t* out, char sign, const char* str, uint16_t len, uint8_t width, uint8_t flags){
+	// Local Variables
+	uint16_t total = len + (sign ? 1 : 0);
+	uint16_t pad = (width > total) ? (width - total) : 0;
+	// Right aligned with spaces
+	if(!(flags & (USARTx_FORMAT_FLAG_LEFT | USARTx_FORMAT_FLAG_ZERO)))
+		while(pad){ USART_Format_Putc(out, ' '); pad--; }
+	// Sign
+	if(sign)
+		USART_Format_Putc(out, sign);
+	// Right aligned with zeros (after the sign)
+	if(!(flags & USARTx_FORMAT_FLAG_LEFT))
+		while(pad){ USART_Format_Putc(out, '0'); pad--; }
+	// Field
+	while(len--)
+		USART_Format_Putc(out, *str++);
+	// Left aligned
+	while(pad){ USART_Format_Putc(out, ' '); pad--; }
+}
+
+/**
+ * @brief Formats data into a buffer (no allocation, single pass)
+ * @param[out] buffer Destination (always '\0' terminated)
+ * @param[in] size Size of the destination
  * @param[in] format The formatted string
- * @note `float` decimal restricted max to 6 places
+ * @param[in] args Arguments
+ * @returns Number of characters written (excluding '\0'), output is truncated to `size - 1`
  */
-void USART_printf(usart_config_t* USART_CONFIGx, const char* format, ...) {
-	// Starts VA
-	va_list args;
-	va_start(args, format);
+uint16_t USART_vsnprintf(char* buffer, uint16_t size, const char* format, va_list args){
+	// Local Variables
+	usart_format_t out = {.buffer = buffer, .size = size, .len = 0};
+	char digits[24];
+	uint8_t len = 0;
+	uint8_t flags = USARTx_FORMAT_FLAG_NONE;
+	uint8_t width = 0;
+	uint8_t precision = 0;
+	uint8_t has_precision = 0;
+	char sign = '\0';
+	int32_t num = 0;
+	uint32_t unum = 0;
+	const char* str = NULL;
+	// No room
+	if((buffer == NULL) || (size == 0))
+		return 0;
+
 	// Data Present
-	while (*format) {
-		// Format Specifier Encountered
-		if (*format == '%'){
-			// Move to the next character
+	while(*format){
+		// Non-format specifier character
+		if(*format != '%'){
+			USART_Format_Putc(&out, *format++);
+			continue;
+		}
+		format++;
+		// Flags
+		flags = USARTx_FORMAT_FLAG_NONE;
+		while(1){
+			if(*format == '-') flags |= USARTx_FORMAT_FLAG_LEFT;
+			else if(*format == '0') flags |= USARTx_FORMAT_FLAG_ZERO;
+			else if(*format == '+') flags |= USARTx_FORMAT_FLAG_PLUS;
+			else if(*format == ' ') flags |= USARTx_FORMAT_FLAG_SPACE;
+			else break;
+			format++;
+		}
+		// Width
+		width = 0;
+		while((*format >= '0') && (*format <= '9'))
+			width = (uint8_t)((width * 10) + (*format++ - '0'));
+		// Precision
+		has_precision = 0;
+		precision = 0;
+		if(*format == '.'){
+			format++;
+			has_precision = 1;
+			while((*format >= '0') && (*format <= '9'))
+				precision = (uint8_t)((precision * 10) + (*format++ - '0'));
+		}
+		// Length: `long` & `short` are passed as 32-bit/promoted `int` on Cortex-M3
+		while((*format == 'l') || (*format == 'h'))
 			format++;
+		// Sign for signed conversions
+		sign = (flags & USARTx_FORMAT_FLAG_PLUS) ? '+' : ((flags & USARTx_FORMAT_FLAG_SPACE) ? ' ' : '\0');
+
+		// Conversion
+		switch(*format){
 			// Character
-			if(*format == 'c'){
-				// Handle character
-				char c = (char)va_arg(args, int);
-				USART_putc(USART_CONFIGx, c);
-			}
+			case 'c':
+				digits[0] = (char)va_arg(args, int);
+				USART_Format_Field(&out, '\0', digits, 1, width, flags & USARTx_FORMAT_FLAG_LEFT);
+				break;
 			// String
-			else if(*format == 's'){
-				// Handle string
-				char* str = va_arg(args, char*);
-				while (*str) {
-					USART_putc(USART_CONFIGx, *str++);
-				}
-			} 
-			// Integer
-			else if(*format == 'd'){
-				// Handle integer
-				int32_t num = va_arg(args, int);
-				// Storing the integer value after converting it to character
-				char buffer[10];
-				// Buffer Index
+			case 's':
+				str = va_arg(args, const char*);
+				if(str == NULL)
+					str = "(null)";
+				// Precision limits the number of characters
+				for(unum = 0; str[unum] && (!has_precision || (unum < precision)); unum++);
+				USART_Format_Field(&out, '\0', str, (uint16_t)unum, width, flags & USARTx_FORMAT_FLAG_LEFT);
+				break;
+			// Signed Integer
+			case 'd':
+			case 'i':
+				num = va_arg(args, int32_t);
+				if(num < 0)
+					sign = '-';
+				// Magnitude (INT32_MIN safe)
+				unum = (num < 0) ? (0U - (uint32_t)num) : (uint32_t)num;
+				len = USART_Format_Utoa(digits, unum, 10, 0);
+				USART_Format_Field(&out, sign, digits, len, width, flags);
+				break;
+			// Unsigned Integer
+			case 'u':
+				len = USART_Format_Utoa(digits, va_arg(args, uint32_t), 10, 0);
+				USART_Format_Field(&out, '\0', digits, len, width, flags);
+				break;
+			// Hexadecimal
+			case 'x':
+			case 'X':
+				len = USART_Format_Utoa(digits, va_arg(args, uint32_t), 16, (*format == 'X'));
+				USART_Format_Field(&out, '\0', digits, len, width, flags);
+				break;
+			// Pointer: 0x + 8 digits
+			case 'p':
+				USART_Format_Putc(&out, '0');
+				USART_Format_Putc(&out, 'x');
+				len = USART_Format_Utoa(digits, (uint32_t)va_arg(args, void*), 16, 0);
+				USART_Format_Field(&out, '\0', digits, len, 8, USARTx_FORMAT_FLAG_ZERO);
+				break;
+			// Float: one scaling multiply, then integer digits only
+			case 'f':
+			case 'F':
+			{
+				double value = va_arg(args, double);
+				uint64_t scaled = 0;
+				uint32_t int_part = 0;
+				uint32_t frac_part = 0;
 				uint8_t i = 0;
-				// Negative Number Indicator
-				char isNegative = 0;
-				// Negative Number
-				if (num < 0) {
-					isNegative = 1;
-					num = -num;
+				// Precision
+				if(!has_precision)
+					precision = USARTx_PRINTF_FLOAT_PRECISION;
+				if(precision > USARTx_PRINTF_FLOAT_PRECISION_MAX)
+					precision = USARTx_PRINTF_FLOAT_PRECISION_MAX;
+				// Not a Number
+				if(value != value){
+					USART_Format_Field(&out, '\0', "nan", 3, width, flags & USARTx_FORMAT_FLAG_LEFT);
+					break;
 				}
-				// `int` to `char` (Reverse Storing)
-				do {
-					buffer[i++] = (num % 10) + '0';
-					num /= 10;
-				} while (num > 0);
-				// Add negative sign if required
-				if (isNegative) buffer[i++] = '-';
-				// Print it in reverse order
-				while (i > 0) {
-					USART_putc(USART_CONFIGx, buffer[--i]);
+				// Sign
+				if(value < 0){
+					sign = '-';
+					value = -value;
 				}
-			}
-			// Float Handling
-			else if(*format == '.' || *format == 'f'){
-				// Default precision
-				uint8_t precision = 4;
-				// Update Precision
-				if(*format == '.'){
-					// Go to next position
-					format++;
-					precision = (*format - '0');
-					// Wrap precision if greater than 6 
-					precision = (precision > 6)? 6 : precision;
-					// Go to next position
-					format++;
+				// Out of the 32-bit integer part range (includes infinity)
+				if(value >= 4294967295.0){
+					USART_Format_Field(&out, sign, "ovf", 3, width, flags & USARTx_FORMAT_FLAG_LEFT);
+					break;
 				}
-				// Confirmation for float
-				if(*format == 'f'){
-					// Get float value
-					float f = (float)va_arg(args, double);
-					// Handle negative numbers
-					uint8_t is_negative = 0;
-					if(f < 0) {
-						is_negative = 1;
-						f = -f;
-					}
-					// Split into integer and fractional parts
-					int32_t int_part = (int32_t)f;
-					float frac_part = f - int_part;
-					// Convert fractional part to fixed-point integer
-					uint32_t frac_fixed = 0;
-					for(uint8_t i = 0; i < precision; i++) {
-						frac_part *= 10.0f;
-						frac_fixed = frac_fixed * 10 + (uint32_t)frac_part;
-						frac_part -= (uint32_t)frac_part;
-					}
-					// Print sign
-					if(is_negative) 
-						USART_putc(USART_CONFIGx, '-');
-					// Print integer part
-					char int_buf[12] = {'\0'};
-					uint8_t idx = 0;
-					do {
-						int_buf[idx++] = (int_part % 10) + '0';
-						int_part /= 10;
-					} while(int_part > 0);
-					// Print on the console
-					while(idx > 0) {
-						USART_putc(USART_CONFIGx, int_buf[--idx]);
-					}
-					// Print decimal point
-					USART_putc(USART_CONFIGx, '.');
-					// Print fractional part using fixed-point math
-					char frac_buf[6] = {'\0'};
-					for(uint8_t i = 0; i < precision; i++) {
-						frac_buf[i] = (frac_fixed % 10) + '0';
-						frac_fixed /= 10;
-					}
-					for(int8_t i = precision - 1; i >= 0; i--) {
-						USART_putc(USART_CONFIGx, frac_buf[i]);
+				// Fixed point: value * 10^precision, rounded to nearest
+				scaled = (uint64_t)((value * (double)usart_pow10[precision]) + 0.5);
+				int_part = (uint32_t)(scaled / usart_pow10[precision]);
+				frac_part = (uint32_t)(scaled - ((uint64_t)int_part * usart_pow10[precision]));
+				// Integer Part
+				len = USART_Format_Utoa(digits, int_part, 10, 0);
+				// Fractional Part (leading zeros kept)
+				if(precision){
+					digits[len++] = '.';
+					for(i = precision; i > 0; i--){
+						digits[len + i - 1] = '0' + (frac_part % 10);
+						frac_part /= 10;
 					}
+					len += precision;
 				}
+				USART_Format_Field(&out, sign, digits, len, width, flags);
+				break;
 			}
-			// Handle unknown format specifier
-			else {
-				const char* unknown_msg = "Unknown format specifier\n";
-				while (*unknown_msg) {
-					USART_putc(USART_CONFIGx, *unknown_msg++);
-				}
-			}
-		}
-		// Non-format specifier character
-		else {
-			USART_putc(USART_CONFIGx, *format);
+			// Percent
+			case '%':
+				USART_Format_Putc(&out, '%');
+				break;
+			// End of string after '%'
+			case '\0':
+				format--;
+				break;
+			// Unknown: printed as is
+			default:
+				USART_Format_Putc(&out, '%');
+				USART_Format_Putc(&out, *format);
+				break;
 		}
 		// Go to next character
 		format++;
 	}
+	// Terminate
+	out.buffer[out.len] = '\0';
+	// Characters written
+	return out.len;
+}
+
+/**
+ * @brief Formats data into a buffer (no allocation, single pass)
+ * @param[out] buffer Destination (always '\0' terminated)
+ * @param[in] size Size of the destination
+ * @param[in] format The formatted string
+ * @returns Number of characters written (excluding '\0'), output is truncated to `size - 1`
+ */
+uint16_t USART_snprintf(char* buffer, uint16_t size, const char* format, ...){
+	// Local Variable
+	uint16_t len = 0;
+	// Starts VA
+	va_list args;
+	va_start(args, format);
+	len = USART_vsnprintf(buffer, size, format, args);
+	// Ends the VA
+	va_end(args);
+	// Characters written
+	return len;
+}
+
+/**
+ * @brief Transmits a buffer on USART in one operation
+ * @param[in] USART_CONFIGx USART Configuration Structure
+ * @param[in] data Pointer to the data
+ * @param[in] len Number of bytes
+ * @note - Interrupt/DMA driven TX: queued at once, waits only while the TX Queue is full
+ * @note - Polling TX: transmitted byte by byte
+ */
+void USART_Write(usart_config_t* USART_CONFIGx, const uint8_t* data, uint16_t len){
+	// Local Variable
+	uint16_t queued = 0;
+	// Polling TX
+	if(usart_irq_handle[USART_get_index(USART_CONFIGx->USARTx)].tx == NULL){
+		while(len--)
+			USART_putc(USART_CONFIGx, (char)*data++);
+		return;
+	}
+	// Interrupt/DMA driven TX
+	while(len){
+		queued = USART_IRQ_Write(USART_CONFIGx, data, len);
+		data += queued;
+		len -= queued;
+	}
+}
+
+/**
+ * @brief Transmits formatted data on USART
+ * @param[in] USART_CONFIGx USART Configuration Structure
+ * @param[in] format The formatted string
+ * @note - Rendered into a `USARTx_PRINTF_BUFFER_SIZE` stack buffer, then handed to the TX engine at once
+ * @note - Supports `%c %s %d %i %u %x %X %p %f %%`, flags `- 0 + space`, width, precision & `l`/`h` length
+ * @note - `float` uses `USARTx_PRINTF_FLOAT_PRECISION` decimals by default, max `USARTx_PRINTF_FLOAT_PRECISION_MAX`
+ */
+void USART_printf(usart_config_t* USART_CONFIGx, const char* format, ...) {
+	// Local Variables
+	char buffer[USARTx_PRINTF_BUFFER_SIZE];
+	uint16_t len = 0;
+	// Starts VA
+	va_list args;
+	va_start(args, format);
+	// Single pass formatting
+	len = USART_vsnprintf(buffer, sizeof(buffer), format, args);
 	// Ends the VA
 	va_end(args);
+	// One-shot handoff
+	USART_Write(USART_CONFIGx, (const uint8_t *)buffer, len);
 }
 
 /**
@@ -228,6 +482,12 @@ void USART_printf(usart_config_t* USART_CONFIGx, const char* format, ...) {
 uint16_t USART_receive(usart_config_t* USART_CONFIGx){
 	// Result
 	uint16_t result = 0;
+	uint8_t data = 0;
+	// Interrupt driven RX: wait for the queue
+	if(usart_irq_handle[USART_get_index(USART_CONFIGx->USARTx)].rx != NULL){
+		while(!USART_IRQ_Read(USART_CONFIGx, &data, 1));
+		return data;
+	}
 	// RXNE (Received data is ready to be read)
 	while(!(USART_CONFIGx->USARTx->SR.REG & USART_SR_RXNE));
 	// Read received data
@@ -265,3 +525,233 @@ void USART_load_default(usart_config_t* USART_CONFIGx){
 	// Enable RX
 	USART_CONFIGx->RXE = USARTx_RX_ENABLE;
 }
+
+/**
+ * @brief Starts draining the TX Queue (DMA spans if enabled & available, TXE Interrupt otherwise)
+ * @param[in] USARTx USART Instance: `USART1`, `USART2`, `USART3`
+ * @param[in] handle USART Interrupt Handle
+ * @note Called with interrupts disabled or from the USART ISR
+ */
+static void USART_IRQ_TX_Start(USART_REG_STRUCT* USARTx, usart_irq_handle_t* handle){
+	// DMA running or started
+	if(handle->tx_dma && USART_DMA_TX_Kick(USARTx))
+		return;
+	// Byte per byte from the TXE Interrupt
+	USARTx->CR1.REG |= USART_CR1_TXEIE;
+}
+
+/**
+ * @brief Switches USART to Interrupt driven TX/RX
+ * @param[in] USART_CONFIGx USART Configuration Structure (configured & enabled)
+ * @param[in] tx TX Queue (may be NULL to keep polling TX)
+ * @param[in] rx RX Queue (may be NULL to keep polling RX)
+ * @note - `USART_putc()`, `USART_puts()` & `USART_printf()` return once the data is queued
+ * @note - `USART_receive()` reads from `rx`
+ * @note - `USARTx_IRQHandler()` services RXNE (-> `rx`), TXE (<- `tx`) & TC (end of transmission)
+ */
+void USART_IRQ_Init(usart_config_t* USART_CONFIGx, ring_buffer_t* tx, ring_buffer_t* rx){
+	// Local Variables
+	USART_REG_STRUCT* USARTx = USART_CONFIGx->USARTx;
+	usart_irq_handle_t* handle = &usart_irq_handle[USART_get_index(USARTx)];
+	// Disable Global Interrupt
+	__disable_irq();
+	// Attach Queues
+	handle->tx = tx;
+	handle->rx = rx;
+	handle->tx_active = 0x00;
+	handle->tx_dma = 0x00;
+	handle->tx_dma_len = 0x00;
+	handle->rx_dropped = 0x00;
+	handle->rx_errors = 0x00;
+	// TX starts on the first queued byte
+	USARTx->CR1.REG &= ~(USART_CR1_TXEIE | USART_CR1_TCIE);
+	// RX Not Empty Interrupt
+	if(rx != NULL)
+		USARTx->CR1.REG |= USART_CR1_RXNEIE;
+	// Enable Global Interrupt
+	__enable_irq();
+	// Enable NVIC IRQ
+	NVIC_IRQ_Enable(USART_get_IRQn(USARTx));
+}
+
+/**
+ * @brief Switches USART back to Polling TX/RX
+ * @param[in] USART_CONFIGx USART Configuration Structure
+ * @note Pending TX data is flushed first
+ */
+void USART_IRQ_DeInit(usart_config_t* USART_CONFIGx){
+	// Local Variables
+	USART_REG_STRUCT* USARTx = USART_CONFIGx->USARTx;
+	usart_irq_handle_t* handle = &usart_irq_handle[USART_get_index(USARTx)];
+	// Drain the TX Queue
+	USART_IRQ_Flush(USART_CONFIGx);
+	// Disable Global Interrupt
+	__disable_irq();
+	// Disable Interrupts
+	USARTx->CR1.REG &= ~(USART_CR1_TXEIE | USART_CR1_TCIE | USART_CR1_RXNEIE);
+	// Detach Queues
+	handle->tx = NULL;
+	handle->rx = NULL;
+	handle->tx_dma = 0x00;
+	USART_DMA_TX_Disable(USARTx);
+	// Enable Global Interrupt
+	__enable_irq();
+}
+
+/**
+ * @brief Queues data for Interrupt driven transmission
+ * @param[in] USART_CONFIGx USART Configuration Structure
+ * @param[in] data Pointer to the data
+ * @param[in] len Number of bytes
+ * @returns Number of bytes queued (less than `len` if the TX Queue is full)
+ */
+uint16_t USART_IRQ_Write(usart_config_t* USART_CONFIGx, const uint8_t* data, uint16_t len){
+	// Local Variables
+	USART_REG_STRUCT* USARTx = USART_CONFIGx->USARTx;
+	usart_irq_handle_t* handle = &usart_irq_handle[USART_get_index(USARTx)];
+	uint16_t count = 0;
+	// Polling TX
+	if(handle->tx == NULL)
+		return 0;
+	// Producer side: only `head` is updated, the ISR only updates `tail`
+	while((count < len) && Ring_Buffer_Enqueue(handle->tx, data[count]))
+		count++;
+	// Start/Continue the transmission
+	if(count)
+		USART_IRQ_TX_Commit(USART_CONFIGx);
+	// Queued bytes
+	return count;
+}
+
+/**
+ * @brief Starts/Continues the transmission of the TX Queue
+ * @param[in] USART_CONFIGx USART Configuration Structure
+ * @note Producers that write directly into the TX Queue storage (e.g. framing encoders) call this after publishing `head`
+ */
+void USART_IRQ_TX_Commit(usart_config_t* USART_CONFIGx){
+	// Local Variables
+	USART_REG_STRUCT* USARTx = USART_CONFIGx->USARTx;
+	usart_irq_handle_t* handle = &usart_irq_handle[USART_get_index(USARTx)];
+	// Polling TX/Nothing queued
+	if((handle->tx == NULL) || Ring_Buffer_Is_Empty(handle->tx))
+		return;
+	// CR1 is also modified by the ISR
+	__disable_irq();
+	handle->tx_active = 0x01;
+	USART_IRQ_TX_Start(USARTx, handle);
+	__enable_irq();
+}
+
+/**
+ * @brief Reads the data received by the Interrupt driven reception
+ * @param[in] USART_CONFIGx USART Configuration Structure
+ * @param[out] data Pointer to the destination buffer
+ * @param[in] len Maximum number of bytes
+ * @returns Number of bytes read
+ */
+uint16_t USART_IRQ_Read(usart_config_t* USART_CONFIGx, uint8_t* data, uint16_t len){
+	// Local Variables
+	usart_irq_handle_t* handle = &usart_irq_handle[USART_get_index(USART_CONFIGx->USARTx)];
+	uint16_t count = 0;
+	// Polling RX
+	if(handle->rx == NULL)
+		return 0;
+	// Consumer side: only `tail` is updated, the ISR only updates `head`
+	while((count < len) && Ring_Buffer_Dequeue(handle->rx, &data[count]))
+		count++;
+	// Read bytes
+	return count;
+}
+
+/**
+ * @brief Waits until the TX Queue is drained and the last frame is shifted out
+ * @param[in] USART_CONFIGx USART Configuration Structure
+ */
+void USART_IRQ_Flush(usart_config_t* USART_CONFIGx){
+	// Cleared from the TC Interrupt
+	while(usart_irq_handle[USART_get_index(USART_CONFIGx->USARTx)].tx_active);
+}
+
+/**
+ * @brief Retrieves the Interrupt Handle of USART (queues & statistics)
+ * @param[in] USARTx USART Instance: `USART1`, `USART2`, `USART3`
+ * @returns Pointer to the USART Interrupt Handle
+ */
+usart_irq_handle_t* USART_IRQ_Get_Handle(USART_REG_STRUCT* USARTx){
+	// Handle
+	return &usart_irq_handle[USART_get_index(USARTx)];
+}
+
+/**
+ * @brief Services the USART Interrupt (RXNE/IDLE/TXE/TC)
+ * @param[in] USARTx USART Instance: `USART1`, `USART2`, `USART3`
+ */
+void USART_IRQ_Handler(USART_REG_STRUCT* USARTx){
+	// Local Variables
+	usart_irq_handle_t* handle = &usart_irq_handle[USART_get_index(USARTx)];
+	uint32_t SR = USARTx->SR.REG;
+	uint32_t CR1 = USARTx->CR1.REG;
+	uint8_t data = 0;
+
+	// Byte received (SR read above + DR read clears RXNE/ORE/FE/NE)
+	if((CR1 & USART_CR1_RXNEIE) && (SR & (USART_SR_RXNE | USART_SR_ORE))){
+		data = (uint8_t) USARTx->DR.REG;
+		// Overrun/Framing/Noise/Parity Error
+		if(SR & (USART_SR_ORE | USART_SR_FE | USART_SR_NE | USART_SR_PE))
+			handle->rx_errors++;
+		// Queue
+		if((handle->rx == NULL) || !Ring_Buffer_Enqueue(handle->rx, data))
+			handle->rx_dropped++;
+	}
+
+	// Line idle after a reception (DMA RX): SR read above + DR read clears IDLE
+	if((CR1 & USART_CR1_IDLEIE) && (SR & USART_SR_IDLE)){
+		(void)USARTx->DR.REG;
+		USART_DMA_RX_Flush(USARTx);
+	}
+
+	// Data register empty
+	if((CR1 & USART_CR1_TXEIE) && (SR & USART_SR_TXE)){
+		// Next byte
+		if((handle->tx != NULL) && Ring_Buffer_Dequeue(handle->tx, &data))
+			USARTx->DR.REG = data;
+		// Queue drained: wait for the last frame to shift out
+		else{
+			USARTx->CR1.REG &= ~USART_CR1_TXEIE;
+			USARTx->CR1.REG |= USART_CR1_TCIE;
+		}
+	}
+
+	// Transmission complete
+	else if((CR1 & USART_CR1_TCIE) && (SR & USART_SR_TC)){
+		// TC is rc_w0: writing 1 to the other bits has no effect
+		USARTx->SR.REG = (uint32_t)~USART_SR_TC;
+		USARTx->CR1.REG &= ~USART_CR1_TCIE;
+		// Data queued after the queue drained restarts the transmission
+		if((handle->tx != NULL) && !Ring_Buffer_Is_Empty(handle->tx))
+			USART_IRQ_TX_Start(USARTx, handle);
+		else
+			handle->tx_active = 0x00;
+	}
+}
+
+/**
+ * @brief USART1 ISR
+ */
+__attribute__((weak)) void USART1_IRQHandler(void){
+	USART_IRQ_Handler(USART1);
+}
+
+/**
+ * @brief USART2 ISR
+ */
+__attribute__((weak)) void USART2_IRQHandler(void){
+	USART_IRQ_Handler(USART2);
+}
+
+/**
+ * @brief USART3 ISR
+ */
+__attribute__((weak)) void USART3_IRQHandler(void){
+	USART_IRQ_Handler(USART3);
+}
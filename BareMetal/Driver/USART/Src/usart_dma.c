@@ -0,0 +1,277 @@
+// Header
+#include "usart_dma.h"
+
+// USART DMA RX Handle
+typedef struct {
+	// Circular DMA Stream
+	dma_stream_t stream;
+	// Index of the first byte not yet delivered
+	uint16_t read;
+	// Span Callback
+	USART_RX_Callback_t callback;
+} usart_dma_rx_t;
+
+// USART DMA RX Handles: [0] -> `USART1`, [1] -> `USART2`, [2] -> `USART3`
+static usart_dma_rx_t usart_dma_rx[3] = {0};
+
+/**
+ * @brief Programs the DMA on the next contiguous span of the TX Queue
+ * @param[in] USARTx USART Instance: `USART1`, `USART2`, `USART3`
+ * @param[in] handle USART Interrupt Handle
+ * @returns - `0x00`: Queue empty
+ * @returns - `0x01`: Span started
+ */
+static uint8_t USART_DMA_TX_Span(USART_REG_STRUCT* USARTx, usart_irq_handle_t* handle){
+	// Local Variables
+	DMA_CHANNEL_REG_STRUCT* DMA_channelX = USART_DMA_Get_TX_Channel(USARTx);
+	ring_buffer_t* tx = handle->tx;
+	uint16_t head = tx->head;
+	// Queue empty
+	if(head == tx->tail)
+		return 0x00;
+	// Contiguous span: up to `head`, or up to the end of the storage if wrapped
+	handle->tx_dma_len = (head > tx->tail) ? (head - tx->tail) : (tx->size - tx->tail);
+	// Memory (Queue storage) -> USARTx->DR
+	DMA_Transfer_Config(DMA_channelX, &tx->buffer[tx->tail], (void *)&USARTx->DR.REG, handle->tx_dma_len);
+	DMA_CH_enable(DMA_channelX);
+	// Span started
+	return 0x01;
+}
+
+/**
+ * @brief Consumes the span transmitted by the DMA and re-arms the next one
+ * @param[in] USARTx USART Instance: `USART1`, `USART2`, `USART3`
+ */
+static void USART_DMA_TX_Next(USART_REG_STRUCT* USARTx){
+	// Local Variable
+	usart_irq_handle_t* handle = USART_IRQ_Get_Handle(USARTx);
+	// Consumer side: release the span to the producers
+	handle->tx->tail = (handle->tx->tail + handle->tx_dma_len) & (handle->tx->size - 1);
+	handle->tx_dma_len = 0x00;
+	// Next span
+	if(USART_DMA_TX_Span(USARTx, handle))
+		return;
+	// Queue drained: free the channel, the USART TC Interrupt tracks the last frame
+	DMA_CH_Release(USART_DMA_Get_TX_Channel(USARTx));
+	USART_DMA_TX_Disable(USARTx);
+	USARTx->CR1.REG |= USART_CR1_TCIE;
+}
+
+/**
+ * @brief USART TX DMA Transfer Complete Callback
+ * @param[in] DMA_channelX DMA Channel
+ * @param[in] context USART Instance
+ */
+static void USART_DMA_TX_TC_Callback(DMA_CHANNEL_REG_STRUCT* DMA_channelX, void* context){
+	// Span transmitted
+	USART_DMA_TX_Next((USART_REG_STRUCT *)context);
+}
+
+/**
+ * @brief USART TX DMA Transfer Error Callback
+ * @param[in] DMA_channelX DMA Channel
+ * @param[in] context USART Instance
+ */
+static void USART_DMA_TX_TE_Callback(DMA_CHANNEL_REG_STRUCT* DMA_channelX, void* context){
+	// Span is dropped (hardware disabled the channel), transmission goes on with the next one
+	USART_DMA_TX_Next((USART_REG_STRUCT *)context);
+}
+
+/**
+ * @brief Switches the USART TX to the DMA Path
+ * @param[in] USART_CONFIGx USART Configuration Structure (configured & enabled)
+ * @param[in] tx TX Queue
+ * @returns - `0x00`: Failure (No TX Queue)
+ * @returns - `0x01`: Success
+ * @note The RX Queue attached by `USART_IRQ_Init()` is kept
+ */
+uint8_t USART_DMA_TX_Init(usart_config_t* USART_CONFIGx, ring_buffer_t* tx){
+	// Local Handle
+	usart_irq_handle_t* handle = USART_IRQ_Get_Handle(USART_CONFIGx->USARTx);
+	// No TX Queue
+	if(tx == NULL)
+		return 0x00;
+	// Interrupt driven mode (TC Interrupt + fallback), keep the RX Queue
+	USART_IRQ_Init(USART_CONFIGx, tx, handle->rx);
+	// DMA Path
+	handle->tx_dma = 0x01;
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Queues data and transmits it through DMA
+ * @param[in] USART_CONFIGx USART Configuration Structure
+ * @param[in] data Pointer to the data
+ * @param[in] len Number of bytes
+ * @returns Number of bytes queued (less than `len` if the TX Queue is full)
+ */
+uint16_t USART_Write_DMA(usart_config_t* USART_CONFIGx, const uint8_t* data, uint16_t len){
+	// Queue + Start (DMA Path selected by `USART_DMA_TX_Init()`)
+	return USART_IRQ_Write(USART_CONFIGx, data, len);
+}
+
+/**
+ * @brief Starts the DMA on the next contiguous span of the TX Queue (if idle)
+ * @param[in] USARTx USART Instance: `USART1`, `USART2`, `USART3`
+ * @returns - `0x00`: DMA not running (Queue empty/Channel owned by another request/TXE Interrupt draining)
+ * @returns - `0x01`: DMA running
+ * @note Producers that enqueue directly into the TX Queue call this to start the transmission
+ */
+uint8_t USART_DMA_TX_Kick(USART_REG_STRUCT* USARTx){
+	// Local Variables
+	usart_irq_handle_t* handle = USART_IRQ_Get_Handle(USARTx);
+	DMA_CHANNEL_REG_STRUCT* DMA_channelX = USART_DMA_Get_TX_Channel(USARTx);
+	uint8_t result = 0x00;
+	uint32_t primask = 0x00;
+	// DMA Path not selected
+	if(!handle->tx_dma || (handle->tx == NULL))
+		return 0x00;
+	// Disable Global Interrupt (also called from the USART ISR & critical sections)
+	primask = __get_PRIMASK();
+	__disable_irq();
+	// Span in flight: the TC callback continues with the new data
+	if(handle->tx_dma_len)
+		result = 0x01;
+	// TXE Interrupt draining (fallback burst) must not race with the DMA
+	else if(USARTx->CR1.REG & USART_CR1_TXEIE)
+		result = 0x00;
+	// Queue empty/Channel owned by another request
+	else if(!Ring_Buffer_Is_Empty(handle->tx) && DMA_CH_Allocate(DMA_channelX, USART_DMA_Get_TX_Request(USARTx))){
+		// Channel Configuration: Memory -> USARTx->DR
+		dma_config_t dma_config = {
+			.DMA_Channel = DMA_channelX,
+			.channel = {
+				.direction = DMAx_DIR_READ_MEM,
+				.mem2mem = DMAx_MEM2MEM_DISABLE,
+				.circular_mode = DMAx_CIRC_DISABLE,
+				.priority = DMAx_PRIORITY_MEDIUM
+			},
+			.data = {
+				.srcDataSize = DMAx_DATA_SIZE_BIT_8,
+				.dstDataSize = DMAx_DATA_SIZE_BIT_8,
+				.srcInc = DMAx_INC_ENABLE,
+				.dstInc = DMAx_INC_DISABLE
+			},
+			.interrupt = {
+				.TCIE = DMAx_IRQ_ENABLE,
+				.HTIE = DMAx_IRQ_DISABLE,
+				.TEIE = DMAx_IRQ_ENABLE
+			},
+		};
+		DMA_Config(&dma_config);
+		DMA_CH_clear_flags(DMA_channelX, DMAx_FLAG_ALL);
+		DMA_CH_Register_Callback(DMA_channelX, USART_DMA_TX_TC_Callback, NULL, USART_DMA_TX_TE_Callback, USARTx);
+		// TC is set by the previous frame: clear it so the final TC marks this burst
+		USARTx->SR.REG = (uint32_t)~USART_SR_TC;
+		USARTx->CR1.REG &= ~USART_CR1_TCIE;
+		USART_DMA_TX_Enable(USARTx);
+		// First span
+		result = USART_DMA_TX_Span(USARTx, handle);
+	}
+	// Restore Global Interrupt
+	__set_PRIMASK(primask);
+	// DMA State
+	return result;
+}
+
+/**
+ * @brief USART RX DMA Half/Full Callback: delivers the data before the DMA wraps onto it
+ * @param[in] stream DMA Stream
+ * @param[in] half Unused (spans are computed from the DMA position)
+ * @param[in] count Unused
+ */
+static void USART_DMA_RX_Stream_Callback(dma_stream_t* stream, void* half, uint16_t count){
+	// Deliver up to the DMA position
+	USART_DMA_RX_Flush((USART_REG_STRUCT *)stream->context);
+}
+
+/**
+ * @brief Starts the circular DMA Reception with IDLE line detection
+ * @param[in] USART_CONFIGx USART Configuration Structure (configured & enabled)
+ * @param[in] buffer Circular Buffer (must stay valid while receiving)
+ * @param[in] size Size of the buffer (even)
+ * @param[in] callback Called with every received span (executed in interrupt context)
+ * @returns - `0x00`: Failure (Odd/Zero size/No callback/DMA Channel owned by another request)
+ * @returns - `0x01`: Success
+ * @note The RXNE Interrupt is disabled: `USART_receive()`/`USART_IRQ_Read()` are not used in this mode
+ */
+uint8_t USART_DMA_RX_Init(usart_config_t* USART_CONFIGx, uint8_t* buffer, uint16_t size, USART_RX_Callback_t callback){
+	// Local Variables
+	USART_REG_STRUCT* USARTx = USART_CONFIGx->USARTx;
+	usart_dma_rx_t* rx = &usart_dma_rx[USART_get_index(USARTx)];
+	// No callback
+	if(callback == NULL)
+		return 0x00;
+	// Circular Stream: USARTx->DR -> buffer
+	rx->stream.DMA_Channel = USART_DMA_Get_RX_Channel(USARTx);
+	rx->stream.request = USART_DMA_Get_RX_Request(USARTx);
+	rx->stream.direction = DMAx_DIR_READ_PER;
+	rx->stream.priority = DMAx_PRIORITY_HIGH;
+	rx->stream.perDataSize = DMAx_DATA_SIZE_BIT_8;
+	rx->stream.memDataSize = DMAx_DATA_SIZE_BIT_8;
+	rx->stream.peripheral = &USARTx->DR.REG;
+	rx->stream.buffer = buffer;
+	rx->stream.count = size;
+	rx->stream.callback = USART_DMA_RX_Stream_Callback;
+	rx->stream.context = USARTx;
+	rx->read = 0x00;
+	rx->callback = callback;
+	// Bytes are taken by the DMA, not by the RXNE Interrupt
+	USARTx->CR1.REG &= ~USART_CR1_RXNEIE;
+	// Start the Stream (Odd/Zero size/Channel owned)
+	if(!DMA_Stream_Start(&rx->stream))
+		return 0x00;
+	USART_DMA_RX_Enable(USARTx);
+	// IDLE Line: clear the stale flag (SR then DR), then enable its interrupt
+	(void)USARTx->SR.REG;
+	(void)USARTx->DR.REG;
+	USARTx->CR1.REG |= USART_CR1_IDLEIE;
+	NVIC_IRQ_Enable(USART_get_IRQn(USARTx));
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Stops the circular DMA Reception and releases its DMA Channel
+ * @param[in] USART_CONFIGx USART Configuration Structure
+ */
+void USART_DMA_RX_DeInit(usart_config_t* USART_CONFIGx){
+	// Local Variables
+	USART_REG_STRUCT* USARTx = USART_CONFIGx->USARTx;
+	usart_dma_rx_t* rx = &usart_dma_rx[USART_get_index(USARTx)];
+	// Stop the IDLE Interrupt & DMA Requests
+	USARTx->CR1.REG &= ~USART_CR1_IDLEIE;
+	USART_DMA_RX_Disable(USARTx);
+	// Release the Channel
+	DMA_Stream_Stop(&rx->stream);
+	rx->callback = NULL;
+}
+
+/**
+ * @brief Delivers the data received since the last span (called on IDLE, HT & TC)
+ * @param[in] USARTx USART Instance: `USART1`, `USART2`, `USART3`
+ */
+void USART_DMA_RX_Flush(USART_REG_STRUCT* USARTx){
+	// Local Variables
+	usart_dma_rx_t* rx = &usart_dma_rx[USART_get_index(USARTx)];
+	uint8_t* buffer = (uint8_t *)rx->stream.buffer;
+	uint16_t position = 0x00;
+	// Not receiving
+	if(!rx->stream.running || (rx->callback == NULL))
+		return;
+	// Index of the next byte to be written by the DMA
+	position = DMA_Stream_Get_Position(&rx->stream);
+	// Nothing new
+	if(position == rx->read)
+		return;
+	// Wrapped: deliver up to the end of the buffer first
+	if(position < rx->read){
+		rx->callback(USARTx, &buffer[rx->read], rx->stream.count - rx->read);
+		rx->read = 0x00;
+	}
+	// Contiguous span
+	if(position > rx->read)
+		rx->callback(USARTx, &buffer[rx->read], position - rx->read);
+	rx->read = position;
+}
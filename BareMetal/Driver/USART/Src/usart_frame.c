@@ -0,0 +1,280 @@
+// Header
+#include "usart_frame.h"
+
+// CRC16-CCITT Nibble Table (poly `0x1021`)
+static const uint16_t usart_frame_crc_table[16] = {
+	0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+	0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+// Frame being encoded: Header | Payload | CRC seen as one byte sequence
+typedef struct {
+	uint8_t header[USARTx_FRAME_HEADER_SIZE];
+	const uint8_t* payload;
+	uint16_t len;
+	uint8_t crc[USARTx_FRAME_CRC_SIZE];
+} usart_frame_src_t;
+
+// Encoder Output: TX Queue storage (unpublished) or `USART_putc()`
+typedef struct {
+	usart_config_t* USART_CONFIGx;
+	ring_buffer_t* ring;
+	uint16_t index;
+} usart_frame_sink_t;
+
+/**
+ * @brief Computes the CRC16-CCITT (poly `0x1021`)
+ * @param[in] crc Initial value (`USARTx_FRAME_CRC_INIT`) or running CRC
+ * @param[in] data Pointer to the data
+ * @param[in] len Number of bytes
+ * @returns Updated CRC
+ */
+uint16_t USART_Frame_CRC16(uint16_t crc, const uint8_t* data, uint16_t len){
+	// Two nibbles per byte
+	while(len--){
+		crc = (uint16_t)((crc << 4) ^ usart_frame_crc_table[((crc >> 12) ^ (*data >> 4)) & 0x0F]);
+		crc = (uint16_t)((crc << 4) ^ usart_frame_crc_table[((crc >> 12) ^ (*data & 0x0F)) & 0x0F]);
+		data++;
+	}
+	// Updated CRC
+	return crc;
+}
+
+/**
+ * @brief Retrieves a byte of the frame being encoded
+ * @param[in] src Frame being encoded
+ * @param[in] index Byte index (0 - `len + 3`)
+ * @returns Byte
+ */
+__STATIC_INLINE__ uint8_t USART_Frame_Src_Byte(const usart_frame_src_t* src, uint16_t index){
+	// Header
+	if(index < USARTx_FRAME_HEADER_SIZE)
+		return src->header[index];
+	index -= USARTx_FRAME_HEADER_SIZE;
+	// Payload
+	if(index < src->len)
+		return src->payload[index];
+	// CRC
+	return src->crc[index - src->len];
+}
+
+/**
+ * @brief Emits an encoded byte
+ * @param[in] sink Encoder Output
+ * @param[in] byte Encoded byte
+ */
+__STATIC_INLINE__ void USART_Frame_Emit(usart_frame_sink_t* sink, uint8_t byte){
+	// Polling TX
+	if(sink->ring == NULL){
+		USART_putc(sink->USART_CONFIGx, (char)byte);
+		return;
+	}
+	// Beyond `head`: invisible to the ISR/DMA until published
+	sink->ring->buffer[sink->index] = byte;
+	sink->index = (sink->index + 1) & (sink->ring->size - 1);
+}
+
+/**
+ * @brief COBS encodes a frame into the Encoder Output
+ * @param[in] src Frame being encoded
+ * @param[in] sink Encoder Output
+ * @note Each block is `code` + `code - 1` non-zero bytes, the zero after a block (except `0xFF`) is implied
+ */
+static void USART_Frame_COBS_Encode(const usart_frame_src_t* src, usart_frame_sink_t* sink){
+	// Local Variables
+	uint16_t total = src->len + USARTx_FRAME_HEADER_SIZE + USARTx_FRAME_CRC_SIZE;
+	uint16_t index = 0;
+	uint16_t run = 0;
+	uint16_t i = 0;
+	// Blocks
+	while(1){
+		// Non-zero run (look ahead)
+		run = 0;
+		while(((index + run) < total) && (run < USARTx_FRAME_COBS_MAX_RUN) && USART_Frame_Src_Byte(src, index + run))
+			run++;
+		// Block
+		USART_Frame_Emit(sink, (uint8_t)(run + 1));
+		for(i = 0; i < run; i++)
+			USART_Frame_Emit(sink, USART_Frame_Src_Byte(src, index + i));
+		index += run;
+		// End of data
+		if(index >= total)
+			break;
+		// Full block: no zero consumed
+		if(run == USARTx_FRAME_COBS_MAX_RUN)
+			continue;
+		// Skip the zero (implied by the block)
+		index++;
+		// Data ends with a zero: one more (empty) block carries it
+		if(index >= total){
+			USART_Frame_Emit(sink, 0x01);
+			break;
+		}
+	}
+	// Delimiter
+	USART_Frame_Emit(sink, USARTx_FRAME_DELIMITER);
+}
+
+/**
+ * @brief Initializes a Framed Telemetry Channel
+ * @param[in] frame Pointer to the Frame Channel
+ * @param[in] USART_CONFIGx USART Configuration Structure (configured & enabled)
+ * @param[in] rx_buffer Decoded Frame Storage (largest payload + 4 bytes), may be NULL for TX only
+ * @param[in] rx_size Size of the decoded frame storage
+ * @param[in] callback Frame Callback (may be NULL)
+ * @param[in] context User Context
+ * @returns - `0x00`: Failure (No USART/Storage smaller than an empty frame)
+ * @returns - `0x01`: Success
+ */
+uint8_t USART_Frame_Init(usart_frame_t* frame, usart_config_t* USART_CONFIGx, uint8_t* rx_buffer, uint16_t rx_size, USART_Frame_Callback_t callback, void* context){
+	// Invalid Arguments
+	if((frame == NULL) || (USART_CONFIGx == NULL))
+		return 0x00;
+	if((rx_buffer != NULL) && (rx_size < (USARTx_FRAME_HEADER_SIZE + USARTx_FRAME_CRC_SIZE)))
+		return 0x00;
+	// Reset State & Statistics
+	memset(frame, 0, sizeof(usart_frame_t));
+	frame->USART_CONFIGx = USART_CONFIGx;
+	frame->rx_buffer = rx_buffer;
+	frame->rx_size = (rx_buffer != NULL) ? rx_size : 0;
+	frame->callback = callback;
+	frame->context = context;
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Encodes & transmits a frame
+ * @param[in] frame Pointer to the Frame Channel
+ * @param[in] type Message Type ID
+ * @param[in] payload Pointer to the payload (may be NULL if `len` is 0)
+ * @param[in] len Payload length
+ * @returns - `0x00`: Failure (Frame does not fit in the TX Queue, dropped)
+ * @returns - `0x01`: Success
+ */
+uint8_t USART_Frame_Send(usart_frame_t* frame, uint8_t type, const void* payload, uint16_t len){
+	// Local Variables
+	usart_frame_src_t src = {.header = {type, frame->tx_seq}, .payload = (const uint8_t *)payload, .len = len};
+	usart_frame_sink_t sink = {.USART_CONFIGx = frame->USART_CONFIGx, .ring = NULL, .index = 0};
+	usart_irq_handle_t* handle = USART_IRQ_Get_Handle(frame->USART_CONFIGx->USARTx);
+	uint16_t crc = USARTx_FRAME_CRC_INIT;
+	// No payload
+	if(payload == NULL)
+		src.len = 0;
+
+	// Interrupt/DMA driven TX: the whole frame must fit
+	if(handle->tx != NULL){
+		if(Ring_Buffer_Available_Space(handle->tx) < USARTx_FRAME_ENCODED_SIZE((uint32_t)src.len)){
+			frame->tx_dropped++;
+			return 0x00;
+		}
+		sink.ring = handle->tx;
+		sink.index = handle->tx->head;
+	}
+	// Trailer: CRC over Header + Payload
+	crc = USART_Frame_CRC16(crc, src.header, USARTx_FRAME_HEADER_SIZE);
+	crc = USART_Frame_CRC16(crc, src.payload, src.len);
+	src.crc[0] = (uint8_t)(crc & 0xFF);
+	src.crc[1] = (uint8_t)(crc >> 8);
+	// Encode
+	USART_Frame_COBS_Encode(&src, &sink);
+	// Publish the frame at once & start the transmission
+	if(sink.ring != NULL){
+		sink.ring->head = sink.index;
+		Ring_Buffer_Update_Peak(sink.ring);
+		USART_IRQ_TX_Commit(frame->USART_CONFIGx);
+	}
+	// Statistics
+	frame->tx_seq++;
+	frame->tx_frames++;
+	// Success
+	return 0x01;
+}
+
+/**
+ * @brief Stores a decoded byte
+ * @param[in] frame Pointer to the Frame Channel
+ * @param[in] byte Decoded byte
+ */
+__STATIC_INLINE__ void USART_Frame_RX_Store(usart_frame_t* frame, uint8_t byte){
+	// Frame larger than the storage
+	if(frame->rx_len >= frame->rx_size){
+		frame->rx_overflow = 0x01;
+		return;
+	}
+	frame->rx_buffer[frame->rx_len++] = byte;
+}
+
+/**
+ * @brief Validates & delivers the decoded frame (on delimiter)
+ * @param[in] frame Pointer to the Frame Channel
+ */
+static void USART_Frame_RX_Complete(usart_frame_t* frame){
+	// Local Variables
+	uint16_t len = frame->rx_len;
+	uint16_t crc = 0;
+	uint8_t seq = 0;
+	// Empty (back to back delimiters)
+	if((len == 0) && !frame->rx_overflow && !frame->rx_remaining)
+		return;
+	// Truncated block/Overflow/Shorter than Header + CRC
+	if(frame->rx_remaining || frame->rx_overflow || (len < (USARTx_FRAME_HEADER_SIZE + USARTx_FRAME_CRC_SIZE))){
+		frame->rx_framing_errors++;
+		return;
+	}
+	// CRC
+	crc = USART_Frame_CRC16(USARTx_FRAME_CRC_INIT, frame->rx_buffer, len - USARTx_FRAME_CRC_SIZE);
+	if(crc != (uint16_t)(frame->rx_buffer[len - 2] | (frame->rx_buffer[len - 1] << 8))){
+		frame->rx_crc_errors++;
+		return;
+	}
+	// Sequence
+	seq = frame->rx_buffer[1];
+	if(frame->rx_seq_valid && (seq != frame->rx_seq))
+		frame->rx_seq_gaps++;
+	frame->rx_seq = seq + 1;
+	frame->rx_seq_valid = 0x01;
+	frame->rx_frames++;
+	// Deliver
+	if(frame->callback != NULL)
+		frame->callback(frame, frame->rx_buffer[0], seq, &frame->rx_buffer[USARTx_FRAME_HEADER_SIZE], len - USARTx_FRAME_HEADER_SIZE - USARTx_FRAME_CRC_SIZE);
+}
+
+/**
+ * @brief Feeds received bytes to the incremental decoder
+ * @param[in] frame Pointer to the Frame Channel
+ * @param[in] data Pointer to the received bytes
+ * @param[in] len Number of bytes
+ * @note The Frame Callback is called from here for every valid frame
+ */
+void USART_Frame_Decode(usart_frame_t* frame, const uint8_t* data, uint16_t len){
+	// Local Variable
+	uint8_t byte = 0;
+	// TX only
+	if(frame->rx_buffer == NULL)
+		return;
+	// Byte by byte (state is kept across calls)
+	while(len--){
+		byte = *data++;
+		// Delimiter: frame boundary
+		if(byte == USARTx_FRAME_DELIMITER){
+			USART_Frame_RX_Complete(frame);
+			frame->rx_len = 0;
+			frame->rx_remaining = 0;
+			frame->rx_overflow = 0x00;
+			frame->rx_zero = 0x00;
+			continue;
+		}
+		// Block Data
+		if(frame->rx_remaining){
+			USART_Frame_RX_Store(frame, byte);
+			frame->rx_remaining--;
+			continue;
+		}
+		// Block Code: the previous block (if not `0xFF`) ended with a zero
+		if(frame->rx_zero)
+			USART_Frame_RX_Store(frame, 0x00);
+		frame->rx_remaining = byte - 1;
+		frame->rx_zero = (byte != 0xFF);
+	}
+}
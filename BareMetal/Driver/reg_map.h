@@ -71,6 +71,8 @@
 #define SysTick_BASE_ADDR					0xE000E010
 #define NVIC_BASE_ADDR						0xE000E100
 #define CPU_ID_BASE_ADDR					0xE000ED00
+#define DWT_BASE_ADDR						0xE0001000
+#define DEMCR_ADDR							0xE000EDFC
 #define APB1_BASE_ADDR						0x40000000
 #define APB2_BASE_ADDR						0x40010000
 #define AHB_BASE_ADDR						0x40018000
@@ -348,6 +350,19 @@
 // I2C Mode
 #define I2Cx_MODE_STD						(0x00)
 #define I2Cx_MODE_FAST						(0x01)
+// I2C Peripheral Clock Limits (FREQ[5:0], in MHz)
+#define I2Cx_FREQ_MIN_MHz					(2)
+#define I2Cx_FREQ_FAST_MIN_MHz				(4)
+#define I2Cx_FREQ_MAX_MHz					(36)
+// I2C CCR Limits (CCR[11:0])
+#define I2Cx_CCR_STD_MIN					(4)
+#define I2Cx_CCR_FAST_MIN					(1)
+#define I2Cx_CCR_MAX						(0x0FFF)
+// I2C SCL Timing Limits (in ns)
+#define I2Cx_STD_TLOW_MIN_NS				(4700)
+#define I2Cx_STD_THIGH_MIN_NS				(4000)
+#define I2Cx_FAST_TLOW_MIN_NS				(1300)
+#define I2Cx_FAST_THIGH_MIN_NS				(600)
 // I2C Interrupt Mapping
 #define	I2Cx_IRQ_EVENT						(0x01)
 #define I2Cx_IRQ_BUFFER						(0x02)
@@ -359,6 +374,48 @@
 // I2C Slave R/W Definitions
 #define I2Cx_WRITE							(0x00)
 #define I2Cx_READ							(0x01)
+// I2C DMA Transfer State
+#define I2Cx_DMA_STATE_READY				(0x00)
+#define I2Cx_DMA_STATE_BUSY_TX				(0x01)
+#define I2Cx_DMA_STATE_BUSY_TX_BTF			(0x02)
+#define I2Cx_DMA_STATE_BUSY_RX				(0x03)
+// I2C Error Codes (BERR/ARLO/AF/OVR follow SR1[11:8])
+#define I2Cx_ERR_NONE						(0x00)
+#define I2Cx_ERR_BERR						(0x01)
+#define I2Cx_ERR_ARLO						(0x02)
+#define I2Cx_ERR_AF							(0x04)
+#define I2Cx_ERR_OVR						(0x08)
+#define I2Cx_ERR_TIMEOUT					(0x10)
+// I2C Timeout (per bus stage)
+#define I2Cx_TIMEOUT_US						(2000)
+// Approximate core cycles of a single status polling iteration
+#define I2Cx_POLL_CYCLES					(8)
+// I2C Bus Recovery
+#define I2Cx_RECOVERY_CLOCKS				(9)
+#define I2Cx_RECOVERY_HALF_PERIOD_US		(5)
+// I2C Slave Mode
+#define I2Cx_GENCALL_DISABLE				(0x00)
+#define I2Cx_GENCALL_ENABLE					(0x01)
+#define I2Cx_SLAVE_MAILBOX_REG				(0xFF)
+#define I2Cx_SLAVE_IDLE_BYTE				(0xFF)
+// I2C Bus Manager
+#define I2Cx_BUS_QUEUE_SIZE					(8)
+#define I2Cx_BUS_CHUNK_SIZE					(32)
+// I2C Bus Transaction Priority
+#define I2Cx_BUS_PRIORITY_LOW				(0x00)
+#define I2Cx_BUS_PRIORITY_NORMAL			(0x01)
+#define I2Cx_BUS_PRIORITY_HIGH				(0x02)
+// I2C Bus Transaction Status
+#define I2Cx_BUS_STATUS_IDLE				(0x00)
+#define I2Cx_BUS_STATUS_PENDING				(0x01)
+#define I2Cx_BUS_STATUS_ACTIVE				(0x02)
+#define I2Cx_BUS_STATUS_DONE				(0x03)
+#define I2Cx_BUS_STATUS_ERROR				(0x04)
+#define I2Cx_BUS_STATUS_EXPIRED				(0x05)
+// I2C Bus Transaction Flags
+#define I2Cx_BUS_FLAG_NONE					(0x00)
+#define I2Cx_BUS_FLAG_REG_INC				(0x01)
+#define I2Cx_BUS_FLAG_DEADLINE				(0x02)    // `deadline` is valid (any tick value, 0 included)
 // I2C Peripheral Definitions
 #define I2C1_SCL_GPIO						(GPIOB)
 #define I2C1_SCL_PIN						(GPIOx_PIN_6)
@@ -382,6 +439,16 @@
 #define SYSTICK_DELAYS_2_MS					(2 * SYSTICK_DELAY_1_MS)
 /*********************************************** SysTick MACROS ***********************************************/
 
+/*********************************************** DWT MACROS ***********************************************/
+// Debug Exception & Monitor Control Register: TRCENA enables the DWT
+#define DWT_DEMCR							(*(volatile uint32_t *)(DEMCR_ADDR))
+#define DWT_DEMCR_TRCENA					(1UL << 24)
+// Cycle Counter
+#define DWT_CTRL							(*(volatile uint32_t *)(DWT_BASE_ADDR + 0x00000000))
+#define DWT_CTRL_CYCCNTENA					(1UL << 0)
+#define DWT_CYCCNT							(*(volatile uint32_t *)(DWT_BASE_ADDR + 0x00000004))
+/*********************************************** DWT MACROS ***********************************************/
+
 /*********************************************** Timer MACROS ***********************************************/
 // - Prescaler
 // |-> Timer Frequency: 10kHz 
@@ -428,6 +495,12 @@
 #define TIMx_SMS_ENC_MODE1					(0x01)
 #define TIMx_SMS_ENC_MODE2					(0x02)
 #define TIMx_SMS_ENC_MODE3					(0x03)
+#define TIMx_SMS_RESET						(0x04)    // Trigger edge re-initializes the counter
+
+// Trigger Selection
+#define TIMx_TS_TI1F_ED						(0x04)
+#define TIMx_TS_TI1FP1						(0x05)
+#define TIMx_TS_TI2FP2						(0x06)
 
 // TIM1 REMAP
 #define TIM1_NO_REMAP						(0x00)    // (ETR/PA12, CH1/PA8, CH2/PA9, CH3/PA10, CH4/PA11, BKIN/PB12, CH1N/PB13, CH2N/PB14, CH3N/PB15)
@@ -511,6 +584,49 @@
 #define TIMx_DMA_CC3DE						(0x08)
 #define TIMx_DMA_CC4DE						(0x10)
 
+// Input Capture Selection (CCxS)
+#define TIMx_IC_SEL_DIRECT					(0x01)    // ICx on its own input (IC1 <- TI1, IC2 <- TI2, ...)
+#define TIMx_IC_SEL_INDIRECT				(0x02)    // ICx on the paired input (IC1 <- TI2, IC2 <- TI1, ...)
+#define TIMx_IC_SEL_TRC						(0x03)    // ICx on the slave mode trigger (TRC)
+
+// Input Capture Polarity (CCxP)
+#define TIMx_IC_POL_RISING					(0x00)
+#define TIMx_IC_POL_FALLING					(0x01)
+
+// Input Capture Prescaler (ICxPSC): one capture every N valid edges
+#define TIMx_IC_PSC_DIV_1					(0x00)
+#define TIMx_IC_PSC_DIV_2					(0x01)
+#define TIMx_IC_PSC_DIV_4					(0x02)
+#define TIMx_IC_PSC_DIV_8					(0x03)
+
+// Input Capture Filter (ICxF): edge valid after N consecutive samples at f_SAMPLING
+#define TIMx_IC_FILTER_NONE					(0x00)    // f_DTS, N = 1
+#define TIMx_IC_FILTER_CK_INT_N2			(0x01)
+#define TIMx_IC_FILTER_CK_INT_N4			(0x02)
+#define TIMx_IC_FILTER_CK_INT_N8			(0x03)
+#define TIMx_IC_FILTER_DTS_2_N6				(0x04)
+#define TIMx_IC_FILTER_DTS_2_N8				(0x05)
+#define TIMx_IC_FILTER_DTS_4_N6				(0x06)
+#define TIMx_IC_FILTER_DTS_4_N8				(0x07)
+#define TIMx_IC_FILTER_DTS_8_N6				(0x08)
+#define TIMx_IC_FILTER_DTS_8_N8				(0x09)
+#define TIMx_IC_FILTER_DTS_16_N5			(0x0A)
+#define TIMx_IC_FILTER_DTS_16_N6			(0x0B)
+#define TIMx_IC_FILTER_DTS_16_N8			(0x0C)
+#define TIMx_IC_FILTER_DTS_32_N5			(0x0D)
+#define TIMx_IC_FILTER_DTS_32_N6			(0x0E)
+#define TIMx_IC_FILTER_DTS_32_N8			(0x0F)
+
+// Input Capture Mode
+#define TIMx_IC_MODE_EDGE					(0x00)    // One channel, free running counter timestamps
+#define TIMx_IC_MODE_PWM_INPUT				(0x01)    // TI1 on IC1 (period) & IC2 (high time), counter reset on IC1
+
+// Input Capture Counter: free running over the full 16 bits (timestamp differences modulo 2^16)
+#define TIMx_IC_ARR							(0xFFFF)
+// Input Capture DMA Burst (PWM Input): CCR1 & CCR2 per IC1 request
+#define TIMx_IC_DBA_CCR1					(0x0D)    // (CCR1 offset 0x34) / 4
+#define TIMx_IC_DBL_2_TRANSFERS				(0x01)
+
 /*
 // Error Check MACROS
 #define IS_VALID_GPT(GP_TIMx)				((GP_TIMx) == TIM2 || (GP_TIMx) == TIM3 || (GP_TIMx) == TIM4)
@@ -628,6 +744,31 @@
 #define ADC_CHANNEL_7						(7)
 #define ADC_CHANNEL_8						(8)
 #define ADC_CHANNEL_9						(9)
+#define ADC_CHANNEL_10						(10)
+#define ADC_CHANNEL_11						(11)
+#define ADC_CHANNEL_12						(12)
+#define ADC_CHANNEL_13						(13)
+#define ADC_CHANNEL_14						(14)
+#define ADC_CHANNEL_15						(15)
+#define ADC_CHANNEL_16						(16)
+#define ADC_CHANNEL_17						(17)
+
+// ADC Internal Channels (ADC1 only, TSVREFE)
+#define ADC_CHANNEL_TEMPSENSOR				ADC_CHANNEL_16
+#define ADC_CHANNEL_VREFINT					ADC_CHANNEL_17
+
+// Internal Reference & Temperature Sensor (Datasheet typical values, no factory calibration on F1)
+// - VREFINT (in mV)
+#define ADC_VREFINT_mV						((uint32_t) 1200)
+// - Temperature Sensor voltage at 25 degC (in 10 uV)
+#define ADC_TEMP_V25_10uV					((int32_t) 143000)
+// - Temperature Sensor Average Slope (in 10 uV/degC)
+#define ADC_TEMP_SLOPE_10uV					((int32_t) 430)
+// - Reference Temperature (in 0.01 degC)
+#define ADC_TEMP_REF_centi_C				((int32_t) 2500)
+
+// ADC Regular Sequence
+#define ADC_MAX_SEQUENCE					(16)
 
 // ADC Sample Time
 #define ADC_SAMPLE_1_5						(0)
@@ -651,6 +792,56 @@
 #define ADCx_IRQ_DISABLE					(0)
 #define ADCx_IRQ_ENABLE						(1)
 
+// ADC Regular External Trigger (EXTSEL) for ADC1/ADC2
+#define ADC_EXTSEL_TIM1_CC1					(0)
+#define ADC_EXTSEL_TIM1_CC2					(1)
+#define ADC_EXTSEL_TIM1_CC3					(2)
+#define ADC_EXTSEL_TIM2_CC2					(3)
+#define ADC_EXTSEL_TIM3_TRGO				(4)
+#define ADC_EXTSEL_TIM4_CC4					(5)
+#define ADC_EXTSEL_EXTI11					(6)
+#define ADC_EXTSEL_SWSTART					(7)
+
+// ADC Injected Group (JSQR, JDR1 - JDR4, JOFR1 - JOFR4)
+#define ADC_MAX_INJECTED					(4)
+
+// ADC Injected External Trigger (JEXTSEL) for ADC1/ADC2
+#define ADC_JEXTSEL_TIM1_TRGO				(0)
+#define ADC_JEXTSEL_TIM1_CC4				(1)
+#define ADC_JEXTSEL_TIM2_TRGO				(2)
+#define ADC_JEXTSEL_TIM2_CC1				(3)
+#define ADC_JEXTSEL_TIM3_CC4				(4)
+#define ADC_JEXTSEL_TIM4_TRGO				(5)
+#define ADC_JEXTSEL_EXTI15					(6)
+#define ADC_JEXTSEL_JSWSTART				(7)
+
+// ADC Analog Watchdog Groups (AWDEN/JAWDEN)
+#define ADC_AWD_GROUP_NONE					(0x00)
+#define ADC_AWD_GROUP_REGULAR				(0x01)
+#define ADC_AWD_GROUP_INJECTED				(0x02)
+#define ADC_AWD_GROUP_ALL					(ADC_AWD_GROUP_REGULAR | ADC_AWD_GROUP_INJECTED)
+
+// ADC Analog Watchdog Channel (AWDSGL = 0: every channel of the guarded groups)
+#define ADC_AWD_ALL_CHANNELS				(0xFF)
+
+// ADC Timer Triggered Stream
+// - Timer ticks per trigger: at least 2 (CCR = ARR / 2 needs ARR >= 1)
+#define ADC_STREAM_MIN_TICKS				((uint32_t) 2)
+
+// ADC Dual Mode (DUALMOD, ADC1 CR1)
+#define ADC_DUAL_INDEPENDENT				(0x00)
+#define ADC_DUAL_REG_SIMULT					(0x06)
+#define ADC_DUAL_FAST_INTERLEAVED			(0x07)
+#define ADC_DUAL_SLOW_INTERLEAVED			(0x08)
+
+// ADC Dual Mode Packed Result (ADC1 DR): ADC1 in [15:0], ADC2 in [31:16]
+#define ADC_DUAL_ADC1_DATA(DRx)				((uint16_t)((DRx) & 0xFFFF))
+#define ADC_DUAL_ADC2_DATA(DRx)				((uint16_t)((DRx) >> 16))
+
+// ADC Scan Completion
+#define ADCx_SCAN_STATUS_ERROR				(0x00)
+#define ADCx_SCAN_STATUS_DONE				(0x01)
+
 // ADC Sample Time Channel Decoding
 #define ADC_SAMPLE_CHANNEL(ADC_SAMPLEx)		((uint8_t)(((ADC_SAMPLEx) & 0xF0) >> 4))
 // ADC Sample Time Decoding
@@ -706,12 +897,45 @@
 #define USARTx_PARITY_ODD					(0x01)
 
 // Baud Rate
-#define USARTx_BAUD_4800					((uint16_t) 4800)
-#define USARTx_BAUD_9600					((uint16_t) 9600)
-#define USARTx_BAUD_115200					((uint16_t) 115200)
+#define USARTx_BAUD_4800					((uint32_t) 4800)
+#define USARTx_BAUD_9600					((uint32_t) 9600)
+#define USARTx_BAUD_19200					((uint32_t) 19200)
+#define USARTx_BAUD_38400					((uint32_t) 38400)
+#define USARTx_BAUD_57600					((uint32_t) 57600)
+#define USARTx_BAUD_115200					((uint32_t) 115200)
+#define USARTx_BAUD_230400					((uint32_t) 230400)
+#define USARTx_BAUD_460800					((uint32_t) 460800)
+#define USARTx_BAUD_921600					((uint32_t) 921600)
+#define USARTx_BAUD_2000000					((uint32_t) 2000000)
+#define USARTx_BAUD_2250000					((uint32_t) 2250000)
+#define USARTx_BAUD_4500000					((uint32_t) 4500000)
+
+// Baud Rate Register: BRR = f_PCLK / baud (12-bit Mantissa + 4-bit Fraction of USARTDIV = f_PCLK / (16 * baud))
+#define USARTx_BRR_MIN						(0x0010)
+#define USARTx_BRR_MAX						(0xFFFF)
 
 // Local Delay
 #define USARTx_STRING_TX_DELAY				((uint16_t) 3000)
+
+// Formatted Output
+#define USARTx_PRINTF_BUFFER_SIZE			(128)
+#define USARTx_PRINTF_FLOAT_PRECISION		(4)
+#define USARTx_PRINTF_FLOAT_PRECISION_MAX	(9)
+#define USARTx_FORMAT_FLAG_NONE				(0x00)
+#define USARTx_FORMAT_FLAG_LEFT				(0x01)
+#define USARTx_FORMAT_FLAG_ZERO				(0x02)
+#define USARTx_FORMAT_FLAG_PLUS				(0x04)
+#define USARTx_FORMAT_FLAG_SPACE			(0x08)
+
+// Framed Telemetry: COBS( Type | Sequence | Payload | CRC16 ) + Delimiter
+#define USARTx_FRAME_DELIMITER				(0x00)
+#define USARTx_FRAME_HEADER_SIZE			(2)
+#define USARTx_FRAME_CRC_SIZE				(2)
+#define USARTx_FRAME_CRC_INIT				((uint16_t) 0xFFFF)
+#define USARTx_FRAME_COBS_MAX_RUN			(254)
+// Worst case bytes on the wire for a payload of `len` bytes
+#define USARTx_FRAME_ENCODED_SIZE(len)		(((len) + USARTx_FRAME_HEADER_SIZE + USARTx_FRAME_CRC_SIZE) + \
+											 (((len) + USARTx_FRAME_HEADER_SIZE + USARTx_FRAME_CRC_SIZE) / USARTx_FRAME_COBS_MAX_RUN) + 2)
 /*********************************************** USART MACROS ***********************************************/
 
 /*********************************************** DMA MACROS ***********************************************/
@@ -746,6 +970,38 @@
 #define DMAx_IRQ_DISABLE					(0x00)
 #define DMAx_IRQ_ENABLE						(0x01)
 
+// Channel Interrupt Flags (DMA_ISR/DMA_IFCR nibble of a channel)
+#define DMAx_FLAG_GIF						(0x01)
+#define DMAx_FLAG_TCIF						(0x02)
+#define DMAx_FLAG_HTIF						(0x04)
+#define DMAx_FLAG_TEIF						(0x08)
+#define DMAx_FLAG_ALL						(DMAx_FLAG_GIF | DMAx_FLAG_TCIF | \
+											 DMAx_FLAG_HTIF | DMAx_FLAG_TEIF)
+
+// DMA Channel 1
+#define DMA_ADC1							(DMA1_Channel1)
+#define DMA_TIM2_CH3						(DMA1_Channel1)
+#define DMA_TIM4_CH1						(DMA1_Channel1)
+
+// DMA Channel 2
+#define DMA_USART3_TX						(DMA1_Channel2)
+#define DMA_TIM3_CH3						(DMA1_Channel2)
+
+// DMA Channel 3
+#define DMA_USART3_RX						(DMA1_Channel3)
+#define DMA_TIM3_CH4						(DMA1_Channel3)
+
+// DMA Channel 4
+#define DMA_USART1_TX						(DMA1_Channel4)
+#define DMA_I2C2_TX							(DMA1_Channel4)
+#define DMA_TIM4_CH2						(DMA1_Channel4)
+
+// DMA Channel 5
+#define DMA_USART1_RX						(DMA1_Channel5)
+#define DMA_I2C2_RX							(DMA1_Channel5)
+#define DMA_TIM2_CH1						(DMA1_Channel5)
+#define DMA_TIM4_CH3						(DMA1_Channel5)
+
 // DMA Channel 6
 #define DMA_USART2_RX						(DMA1_Channel6)
 #define DMA_I2C1_TX							(DMA1_Channel6)
@@ -760,8 +1016,169 @@
 #define DMA_TIM2_CH4						(DMA1_Channel7)
 #define DMA_TIM4_UP							(DMA1_Channel7)
 
+// DMA1 Channels (Channel Manager)
+#define DMA1_NUM_CHANNELS					(7)
+
+// DMA1 Request Mapping: bits[2:0] = fixed DMA1 Channel, bits[7:3] = request index within the channel
+#define DMAx_REQ(index, channel)			((uint8_t)(((index) << 3) | (channel)))
+#define DMAx_REQ_GET_CHANNEL(request)		((request) & 0x07)
+#define DMAx_REQ_NONE						(0x00)
+#define DMAx_REQ_MEM2MEM					DMAx_REQ(1, 0)
+// Channel 1
+#define DMAx_REQ_ADC1						DMAx_REQ(1, 1)
+#define DMAx_REQ_TIM2_CH3					DMAx_REQ(2, 1)
+#define DMAx_REQ_TIM4_CH1					DMAx_REQ(3, 1)
+// Channel 2
+#define DMAx_REQ_USART3_TX					DMAx_REQ(1, 2)
+#define DMAx_REQ_TIM1_CH1					DMAx_REQ(2, 2)
+#define DMAx_REQ_TIM2_UP					DMAx_REQ(3, 2)
+#define DMAx_REQ_TIM3_CH3					DMAx_REQ(4, 2)
+#define DMAx_REQ_SPI1_RX					DMAx_REQ(5, 2)
+// Channel 3
+#define DMAx_REQ_USART3_RX					DMAx_REQ(1, 3)
+#define DMAx_REQ_TIM1_CH2					DMAx_REQ(2, 3)
+#define DMAx_REQ_TIM3_CH4					DMAx_REQ(3, 3)
+#define DMAx_REQ_TIM3_UP					DMAx_REQ(4, 3)
+#define DMAx_REQ_SPI1_TX					DMAx_REQ(5, 3)
+// Channel 4
+#define DMAx_REQ_USART1_TX					DMAx_REQ(1, 4)
+#define DMAx_REQ_TIM1_CH4					DMAx_REQ(2, 4)
+#define DMAx_REQ_TIM1_TRIG					DMAx_REQ(3, 4)
+#define DMAx_REQ_TIM1_COM					DMAx_REQ(4, 4)
+#define DMAx_REQ_TIM4_CH2					DMAx_REQ(5, 4)
+#define DMAx_REQ_SPI2_RX					DMAx_REQ(6, 4)
+#define DMAx_REQ_I2C2_TX					DMAx_REQ(7, 4)
+// Channel 5
+#define DMAx_REQ_USART1_RX					DMAx_REQ(1, 5)
+#define DMAx_REQ_TIM1_UP					DMAx_REQ(2, 5)
+#define DMAx_REQ_SPI2_TX					DMAx_REQ(3, 5)
+#define DMAx_REQ_TIM2_CH1					DMAx_REQ(4, 5)
+#define DMAx_REQ_TIM4_CH3					DMAx_REQ(5, 5)
+#define DMAx_REQ_I2C2_RX					DMAx_REQ(6, 5)
+// Channel 6
+#define DMAx_REQ_USART2_RX					DMAx_REQ(1, 6)
+#define DMAx_REQ_TIM1_CH3					DMAx_REQ(2, 6)
+#define DMAx_REQ_TIM3_CH1					DMAx_REQ(3, 6)
+#define DMAx_REQ_TIM3_TRIG					DMAx_REQ(4, 6)
+#define DMAx_REQ_I2C1_TX					DMAx_REQ(5, 6)
+// Channel 7
+#define DMAx_REQ_USART2_TX					DMAx_REQ(1, 7)
+#define DMAx_REQ_TIM2_CH2					DMAx_REQ(2, 7)
+#define DMAx_REQ_TIM2_CH4					DMAx_REQ(3, 7)
+#define DMAx_REQ_TIM4_UP					DMAx_REQ(4, 7)
+#define DMAx_REQ_I2C1_RX					DMAx_REQ(5, 7)
+
+// DMA Memory Service (MEM2MEM)
+#define DMAx_MEM_CHANNEL					(DMA1_Channel3)
+#define DMAx_MEM_CPU_THRESHOLD				(64)
+#define DMAx_MEM_MAX_TRANSFERS				(0xFFFF)
+#define DMAx_MEM_STATUS_ERROR				(0x00)
+#define DMAx_MEM_STATUS_DONE				(0x01)
+// CPU vs DMA Benchmark: `DMAx_MEM_BENCHMARK_MIN_SIZE` << i bytes, i < `DMAx_MEM_BENCHMARK_SIZES` (64B - 4kB)
+#define DMAx_MEM_BENCHMARK_MIN_SIZE			(64)
+#define DMAx_MEM_BENCHMARK_SIZES			(7)
+#define DMAx_MEM_BENCHMARK_MAX_SIZE			(DMAx_MEM_BENCHMARK_MIN_SIZE << (DMAx_MEM_BENCHMARK_SIZES - 1))
+
+// DMA Transfer Chain (Software Scatter-Gather)
+#define DMAx_CHAIN_STATUS_ERROR				(0x00)
+#define DMAx_CHAIN_STATUS_DONE				(0x01)
+
 /*********************************************** DMA MACROS ***********************************************/
 
+/*********************************************** LOG MACROS ***********************************************/
+// Log Levels
+#define LOG_LEVEL_OFF						(0x00)
+#define LOG_LEVEL_ERROR						(0x01)
+#define LOG_LEVEL_WARN						(0x02)
+#define LOG_LEVEL_INFO						(0x03)
+#define LOG_LEVEL_DEBUG						(0x04)
+
+// Compile time level: calls above it generate no code
+#ifndef LOG_LEVEL_COMPILE
+#define LOG_LEVEL_COMPILE					(LOG_LEVEL_DEBUG)
+#endif
+
+// Record Header: [31:8] Format ID, [7:4] Level, [3:0] Number of argument words
+#define LOG_HEADER(id, level, nargs)		((((uint32_t)(id)) << 8) | (((uint32_t)(level) & 0x0F) << 4) | ((uint32_t)(nargs) & 0x0F))
+#define LOG_HEADER_GET_ID(header)			(((header) >> 8) & 0x00FFFFFF)
+#define LOG_HEADER_GET_LEVEL(header)		(((header) >> 4) & 0x0F)
+#define LOG_HEADER_GET_NARGS(header)		((header) & 0x0F)
+#define LOG_MAX_ARGS						(0x0F)
+// Largest record (bytes): header + `LOG_MAX_ARGS` words
+#define LOG_RECORD_MAX_SIZE					((LOG_MAX_ARGS + 1) * sizeof(uint32_t))
+
+// Reserved Format IDs
+#define LOG_ID_DROPPED						(0x00FFFFFF)
+
+// Frame Type of a log record (Framed Telemetry, one record per frame)
+#define LOG_FRAME_TYPE						(0x4C)
+
+// Format String Section (never loaded)
+#define LOG_FMT_SECTION						".log_fmt"
+
+/*********************************************** LOG MACROS ***********************************************/
+
+/*********************************************** SHELL MACROS ***********************************************/
+// Line Editor
+#define SHELL_LINE_SIZE						(64)
+#define SHELL_MAX_ARGS						(8)
+#define SHELL_HISTORY_DEPTH					(4)
+#define SHELL_PROMPT						"> "
+// Bytes consumed per `Shell_Process()` call
+#define SHELL_RX_BUDGET						(16)
+// PWM Outputs reachable by the `pwm` command
+#define SHELL_PWM_SLOTS						(4)
+
+// Command Status
+#define SHELL_CMD_ERROR						(0x00)
+#define SHELL_CMD_OK						(0x01)
+
+// Keys
+#define SHELL_KEY_CTRL_C					(0x03)
+#define SHELL_KEY_BACKSPACE					(0x08)
+#define SHELL_KEY_TAB						(0x09)
+#define SHELL_KEY_LF						(0x0A)
+#define SHELL_KEY_CR						(0x0D)
+#define SHELL_KEY_ESC						(0x1B)
+#define SHELL_KEY_DELETE					(0x7F)
+
+// Escape Sequence State
+#define SHELL_ESC_NONE						(0x00)
+#define SHELL_ESC_START						(0x01)
+#define SHELL_ESC_CSI						(0x02)
+
+/*********************************************** SHELL MACROS ***********************************************/
+
+/*********************************************** DSP MACROS ***********************************************/
+// Fractional Formats
+#define DSP_Q15_SHIFT						(15)
+#define DSP_Q31_SHIFT						(31)
+#define DSP_Q15_MAX							((int16_t) 0x7FFF)
+#define DSP_Q15_MIN							((int16_t) 0x8000)
+#define DSP_Q31_MAX							((int32_t) 0x7FFFFFFF)
+#define DSP_Q31_MIN							((int32_t) 0x80000000)
+
+// 12-bit right aligned ADC result -> Q15: (x - Mid Scale) << 4
+#define DSP_ADC_MID_SCALE					(2048)
+#define DSP_ADC_Q15_SHIFT					(4)
+
+// Oversampling: 4^n samples give n extra bits (12 + n <= 16)
+#define DSP_OVERSAMPLE_MAX_BITS				(4)
+
+// CIC Decimator: bit growth = order * log2(decimation) must fit above the Q15 input in 32 bits
+#define DSP_CIC_MAX_ORDER					(3)
+#define DSP_CIC_MAX_GROWTH					(16)
+
+// Benchmark: block size, result scale & the fixed chain measured by `DSP_Benchmark()`
+#define DSP_BENCHMARK_BLOCK_SIZE			(64)
+#define DSP_BENCHMARK_SCALE					(100)
+#define DSP_BENCHMARK_OVERSAMPLE_BITS		(2)
+#define DSP_BENCHMARK_CIC_ORDER				(3)
+#define DSP_BENCHMARK_CIC_LOG2_DECIMATION	(4)
+#define DSP_BENCHMARK_BIQUAD_STAGES			(2)
+#define DSP_BENCHMARK_FIR_TAPS				(16)
+/*********************************************** DSP MACROS ***********************************************/
+
 /*********************************************** Helper Functions ***********************************************/
 // Size of an array
 // #define SIZEOF(X)							(sizeof((X))/sizeof((X)[0]))
@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+"""Reference host decoder for the framed USART telemetry (usart_frame.c).
+
+Frame on the wire:
+    COBS( Type | Sequence | Payload | CRC16 little endian ) + 0x00 delimiter
+CRC16-CCITT: poly 0x1021, init 0xFFFF, no reflection, over Type, Sequence & Payload.
+
+Usage:
+    frame_decode.py capture.bin             decode a raw capture ('-' for stdin)
+    frame_decode.py --port /dev/ttyUSB0     decode a live serial port (needs pyserial)
+"""
+
+import argparse
+import sys
+from collections import namedtuple
+
+FRAME_DELIMITER = 0x00
+FRAME_HEADER_SIZE = 2
+FRAME_CRC_SIZE = 2
+FRAME_CRC_INIT = 0xFFFF
+COBS_MAX_RUN = 254
+
+Frame = namedtuple("Frame", "type seq payload")
+
+
+def crc16_ccitt(data, crc=FRAME_CRC_INIT):
+    """CRC16-CCITT (poly 0x1021), same as USART_Frame_CRC16()."""
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if (crc & 0x8000) else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def cobs_encode(data):
+    """COBS encoding without the delimiter (mirrors USART_Frame_COBS_Encode())."""
+    out = bytearray()
+    index = 0
+    total = len(data)
+    while True:
+        run = 0
+        while index + run < total and run < COBS_MAX_RUN and data[index + run]:
+            run += 1
+        out.append(run + 1)
+        out += data[index:index + run]
+        index += run
+        if index >= total:
+            break
+        # Full block: no zero consumed
+        if run == COBS_MAX_RUN:
+            continue
+        # Skip the zero implied by the block
+        index += 1
+        # Data ends with a zero: an empty block carries it
+        if index >= total:
+            out.append(0x01)
+            break
+    return bytes(out)
+
+
+def cobs_decode(block):
+    """Decodes one COBS block sequence (delimiter removed). Raises ValueError on a truncated block."""
+    out = bytearray()
+    index = 0
+    zero = False
+    while index < len(block):
+        code = block[index]
+        if code == 0:
+            raise ValueError("zero inside a COBS frame")
+        if index + code > len(block):
+            raise ValueError("truncated COBS block")
+        # The previous block (if not 0xFF) ended with a zero
+        if zero:
+            out.append(0)
+        out += block[index + 1:index + code]
+        index += code
+        zero = (code != 0xFF)
+    return bytes(out)
+
+
+def encode_frame(type_, seq, payload=b""):
+    """Builds a complete frame (delimiter included), byte identical to USART_Frame_Send()."""
+    raw = bytes([type_ & 0xFF, seq & 0xFF]) + bytes(payload)
+    crc = crc16_ccitt(raw)
+    raw += bytes([crc & 0xFF, crc >> 8])
+    return cobs_encode(raw) + bytes([FRAME_DELIMITER])
+
+
+class FrameDecoder:
+    """Incremental decoder: feed() arbitrary chunks, valid frames are returned in order.
+
+    Statistics follow usart_frame_t: frames, crc_errors, framing_errors, seq_gaps.
+    """
+
+    def __init__(self, max_size=4096):
+        self.max_size = max_size
+        self.pending = bytearray()
+        self.overflow = False
+        self.rx_seq = None
+        self.frames = 0
+        self.crc_errors = 0
+        self.framing_errors = 0
+        self.seq_gaps = 0
+
+    def feed(self, data):
+        frames = []
+        for byte in bytes(data):
+            if byte != FRAME_DELIMITER:
+                if len(self.pending) < self.max_size:
+                    self.pending.append(byte)
+                else:
+                    self.overflow = True
+                continue
+            frame = self._complete(bytes(self.pending), self.overflow)
+            self.pending.clear()
+            self.overflow = False
+            if frame is not None:
+                frames.append(frame)
+        return frames
+
+    def _complete(self, encoded, overflow):
+        # Back to back delimiters
+        if not encoded and not overflow:
+            return None
+        try:
+            if overflow:
+                raise ValueError("frame too large")
+            raw = cobs_decode(encoded)
+        except ValueError:
+            self.framing_errors += 1
+            return None
+        if len(raw) < FRAME_HEADER_SIZE + FRAME_CRC_SIZE:
+            self.framing_errors += 1
+            return None
+        if crc16_ccitt(raw[:-FRAME_CRC_SIZE]) != (raw[-2] | (raw[-1] << 8)):
+            self.crc_errors += 1
+            return None
+        seq = raw[1]
+        if self.rx_seq is not None and seq != self.rx_seq:
+            self.seq_gaps += 1
+        self.rx_seq = (seq + 1) & 0xFF
+        self.frames += 1
+        return Frame(raw[0], seq, raw[FRAME_HEADER_SIZE:-FRAME_CRC_SIZE])
+
+
+def open_stream(args):
+    """Returns a read(n) callable for the capture file/stdin or the serial port."""
+    if args.port:
+        try:
+            import serial
+        except ImportError:
+            sys.exit("--port needs pyserial (pip install pyserial)")
+        port = serial.Serial(args.port, args.baud, timeout=0.1)
+        return port.read
+    stream = sys.stdin.buffer if args.input == "-" else open(args.input, "rb")
+    return stream.read
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", nargs="?", default="-", help="raw capture file ('-' for stdin)")
+    parser.add_argument("--port", help="serial port instead of a capture file")
+    parser.add_argument("--baud", type=int, default=115200)
+    args = parser.parse_args()
+
+    read = open_stream(args)
+    decoder = FrameDecoder()
+    try:
+        while True:
+            chunk = read(256)
+            if not chunk:
+                if args.port:
+                    continue
+                break
+            for frame in decoder.feed(chunk):
+                print("type=0x%02X seq=%3u len=%3u %s" % (frame.type, frame.seq, len(frame.payload), frame.payload.hex()))
+    except KeyboardInterrupt:
+        pass
+    print("frames=%u crc_errors=%u framing_errors=%u seq_gaps=%u"
+          % (decoder.frames, decoder.crc_errors, decoder.framing_errors, decoder.seq_gaps), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,35 @@
+/**
+ * Host build of `I2C_Timing_Solve()` (Driver/I2C/Src/i2c_config.c) for tools/test_i2c_timing.py
+ * - RCC/GPIO are stubbed: the APB1 Clock comes from the command line, no register is touched
+ * - Usage: i2c_timing_host <APB1 Hz> <SCL Hz> ...
+ * - Output: one line per request "SCL_achieved freq_MHz mode duty CCR TRISE SCL_readback"
+ */
+
+// Standard I/O
+#include <stdio.h>
+#include <stdlib.h>
+// Solver
+#include "i2c_config.h"
+
+// APB1 Clock seen by the solver
+static uint32_t host_apb1_Hz = 0;
+
+// RCC Stubs
+uint32_t RCC_Get_APB1Clock(void){ return host_apb1_Hz; }
+uint32_t RCC_Get_CoreClock(void){ return host_apb1_Hz; }
+// GPIO Stubs (only reached by `I2C_Bus_Recovery()`)
+void GPIO_Config(gpio_config_t* GPIO_CONFIGx){ (void)GPIO_CONFIGx; }
+uint8_t GPIO_Get_State(gpio_config_t* GPIO_CONFIGx){ (void)GPIO_CONFIGx; return 1; }
+
+int main(int argc, char** argv){
+	// Requests: (APB1, SCL) pairs
+	for(int i = 1; (i + 1) < argc; i += 2){
+		i2c_config_t config = {0};
+		uint32_t scl = 0;
+		host_apb1_Hz = (uint32_t)strtoul(argv[i], NULL, 0);
+		scl = I2C_Timing_Solve(&config, (uint32_t)strtoul(argv[i + 1], NULL, 0));
+		printf("%lu %u %u %u %u %u %lu\n", (unsigned long)scl, config.freq_MHz, config.mode, config.duty,
+			   config.CCR, config.TRISE, (unsigned long)I2C_Get_SCL_Freq(&config));
+	}
+	return 0;
+}
@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+"""Host decoder for the deferred binary log (Driver/Log).
+
+Each record travels as one frame (see frame_decode.py) of type LOG_FRAME_TYPE:
+    Payload = Header word + nargs argument words, little endian
+    Header  = [31:8] Format ID | [7:4] Level | [3:0] nargs
+The Format ID is the address of the format string in the `.log_fmt` section of the ELF
+(low 24 bits), the string is read from the ELF and the argument words are applied to it.
+
+Usage:
+    log_decode.py main.elf capture.bin            decode a raw capture ('-' for stdin)
+    log_decode.py main.elf --port /dev/ttyUSB0    decode a live serial port (needs pyserial)
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+from frame_decode import FrameDecoder, open_stream
+
+LOG_FRAME_TYPE = 0x4C
+LOG_ID_DROPPED = 0x00FFFFFF
+LOG_FMT_SECTION = ".log_fmt"
+LOG_LEVELS = {1: "ERROR", 2: "WARN", 3: "INFO", 4: "DEBUG"}
+
+# printf conversion: flags, width, precision, length modifier (ignored, every argument is one word), conversion
+CONVERSION = re.compile(r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d*))?(?:hh|h|ll|l|j|z|t|L)?([diouxXcpsfFeEgG%])")
+
+
+def read_section(elf, name):
+    """Returns (address, data) of a section of a 32-bit little endian ELF."""
+    if elf[:4] != b"\x7fELF" or elf[4] != 1 or elf[5] != 1:
+        raise ValueError("not a 32-bit little endian ELF")
+    shoff, = struct.unpack_from("<I", elf, 0x20)
+    shentsize, shnum, shstrndx = struct.unpack_from("<HHH", elf, 0x2E)
+    headers = [struct.unpack_from("<IIIIII", elf, shoff + i * shentsize) for i in range(shnum)]
+    strtab = headers[shstrndx]
+    names = elf[strtab[4]:strtab[4] + strtab[5]]
+    for sh_name, _, _, sh_addr, sh_offset, sh_size in headers:
+        if names[sh_name:names.index(b"\x00", sh_name)].decode() == name:
+            return sh_addr, elf[sh_offset:sh_offset + sh_size]
+    raise ValueError("no %s section (is the log module linked?)" % name)
+
+
+def signed(word):
+    return word - (1 << 32) if word & 0x80000000 else word
+
+
+def format_record(fmt, args):
+    """Applies the argument words to a printf format string (one word per conversion)."""
+    args = list(args)
+
+    def take():
+        return args.pop(0) if args else None
+
+    def convert(match):
+        flags, width, precision, conv = match.groups()
+        if conv == "%":
+            return "%"
+        # `*` width/precision consume a word first
+        if width == "*":
+            word = take()
+            width = "" if word is None else str(signed(word))
+        if precision == "*":
+            word = take()
+            precision = "" if word is None else str(max(signed(word), 0))
+        spec = "%" + flags + (width or "") + ("." + precision if precision is not None else "")
+        word = take()
+        if word is None:
+            return "<?>"
+        if conv in "di":
+            return (spec + "d") % signed(word)
+        if conv in "ouxX":
+            return (spec + conv) % word
+        if conv == "c":
+            return (spec + "c") % chr(word & 0xFF)
+        if conv == "p":
+            return "0x%08x" % word
+        if conv == "s":
+            return "<%%s 0x%08x>" % word
+        # `LOG_FLOAT()`: float bit pattern
+        return (spec + conv) % struct.unpack("<f", struct.pack("<I", word))[0]
+
+    return CONVERSION.sub(convert, fmt)
+
+
+class LogDecoder:
+    """Turns log frames into text lines using the `.log_fmt` strings of the ELF."""
+
+    def __init__(self, elf):
+        address, self.strings = read_section(elf, LOG_FMT_SECTION)
+        # IDs are the low 24 bits of the string address
+        self.base = address & 0x00FFFFFF
+        self.frames = FrameDecoder()
+        self.dropped = 0
+        self.bad_records = 0
+
+    def lookup(self, fmt_id):
+        offset = fmt_id - self.base
+        if offset < 0 or offset >= len(self.strings):
+            return None
+        end = self.strings.find(b"\x00", offset)
+        return self.strings[offset:end if end >= 0 else len(self.strings)].decode("utf-8", "replace")
+
+    def decode_record(self, payload):
+        """Returns the text of one record payload."""
+        if len(payload) < 4 or len(payload) % 4:
+            self.bad_records += 1
+            return "<bad record: %s>" % payload.hex()
+        words = struct.unpack("<%uI" % (len(payload) // 4), payload)
+        header, args = words[0], words[1:]
+        fmt_id, level, nargs = header >> 8, (header >> 4) & 0x0F, header & 0x0F
+        if nargs != len(args):
+            self.bad_records += 1
+            return "<bad record: %s>" % payload.hex()
+        prefix = "%-5s " % LOG_LEVELS.get(level, "L%u" % level)
+        if fmt_id == LOG_ID_DROPPED:
+            self.dropped += args[0]
+            return prefix + "%u records dropped (log ring full)" % args[0]
+        fmt = self.lookup(fmt_id)
+        if fmt is None:
+            self.bad_records += 1
+            return prefix + " ".join(["<unknown format id 0x%06x>" % fmt_id] + ["0x%08x" % a for a in args])
+        return prefix + format_record(fmt, args)
+
+    def feed(self, data):
+        """Returns the text lines of the complete records in `data` (other frame types are skipped)."""
+        return [self.decode_record(frame.payload) for frame in self.frames.feed(data) if frame.type == LOG_FRAME_TYPE]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("elf", help="firmware ELF (with the .log_fmt section)")
+    parser.add_argument("input", nargs="?", default="-", help="raw capture file ('-' for stdin)")
+    parser.add_argument("--port", help="serial port instead of a capture file")
+    parser.add_argument("--baud", type=int, default=115200)
+    args = parser.parse_args()
+
+    with open(args.elf, "rb") as f:
+        decoder = LogDecoder(f.read())
+    read = open_stream(args)
+    try:
+        while True:
+            chunk = read(256)
+            if not chunk:
+                if args.port:
+                    continue
+                break
+            for line in decoder.feed(chunk):
+                print(line, flush=True)
+    except KeyboardInterrupt:
+        pass
+    frames = decoder.frames
+    print("frames=%u crc_errors=%u framing_errors=%u seq_gaps=%u dropped=%u bad_records=%u"
+          % (frames.frames, frames.crc_errors, frames.framing_errors, frames.seq_gaps, decoder.dropped,
+             decoder.bad_records), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+"""Round trip tests of the framed USART telemetry: python3 -m unittest discover tools"""
+
+import os
+import random
+import sys
+import unittest
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+from frame_decode import FrameDecoder, cobs_decode, cobs_encode, crc16_ccitt, encode_frame
+
+# Frames produced by USART_Frame_Send() (usart_frame.c built for the host), TX sequence 0 - 3
+C_EMPTY = bytes.fromhex("0201033e2e00")                    # type 0x01, no payload
+C_ZERO_INSIDE = bytes.fromhex("054c0111220433374600")      # type 0x4C, 11 22 00 33
+C_ZERO_ONLY = bytes.fromhex("01020203feaa00")              # type 0x00, 00
+C_LONG_RUN_TYPE = 0x7F                                     # type 0x7F, 300 bytes 1 + (i % 255)
+C_LONG_RUN = bytes.fromhex(
+    "ff7f03" + bytes(range(1, 253)).hex() + "33" + bytes(range(253, 256)).hex()
+    + bytes(range(1, 46)).hex() + "570b00")
+
+
+class TestCRC(unittest.TestCase):
+    def test_check_value(self):
+        # CRC-16/CCITT-FALSE check value
+        self.assertEqual(crc16_ccitt(b"123456789"), 0x29B1)
+
+
+class TestCOBS(unittest.TestCase):
+    VECTORS = [
+        (b"\x00", b"\x01\x01"),
+        (b"\x00\x00", b"\x01\x01\x01"),
+        (b"\x11\x22\x00\x33", b"\x03\x11\x22\x02\x33"),
+        (b"\x11\x22\x33\x44", b"\x05\x11\x22\x33\x44"),
+        (b"\x11\x00\x00\x00", b"\x02\x11\x01\x01\x01"),
+        (bytes(range(1, 255)), b"\xff" + bytes(range(1, 255))),
+    ]
+
+    def test_vectors(self):
+        for raw, encoded in self.VECTORS:
+            self.assertEqual(cobs_encode(raw), encoded)
+            self.assertEqual(cobs_decode(encoded), raw)
+
+    def test_no_zero_and_round_trip(self):
+        rng = random.Random(1)
+        for _ in range(500):
+            raw = bytes(rng.choice((0, 0xFF, rng.randrange(256))) for _ in range(rng.randrange(700)))
+            encoded = cobs_encode(raw)
+            self.assertNotIn(0, encoded)
+            self.assertEqual(cobs_decode(encoded), raw)
+
+
+class TestFrames(unittest.TestCase):
+    def test_matches_c_encoder(self):
+        long_run = bytes(1 + (i % 255) for i in range(300))
+        self.assertEqual(encode_frame(0x01, 0), C_EMPTY)
+        self.assertEqual(encode_frame(0x4C, 1, b"\x11\x22\x00\x33"), C_ZERO_INSIDE)
+        self.assertEqual(encode_frame(0x00, 2, b"\x00"), C_ZERO_ONLY)
+        self.assertEqual(encode_frame(C_LONG_RUN_TYPE, 3, long_run), C_LONG_RUN)
+
+    def test_decodes_c_stream(self):
+        decoder = FrameDecoder()
+        frames = decoder.feed(C_EMPTY + C_ZERO_INSIDE + C_ZERO_ONLY + C_LONG_RUN)
+        self.assertEqual([(f.type, f.seq) for f in frames], [(0x01, 0), (0x4C, 1), (0x00, 2), (0x7F, 3)])
+        self.assertEqual(frames[1].payload, b"\x11\x22\x00\x33")
+        self.assertEqual(frames[3].payload, bytes(1 + (i % 255) for i in range(300)))
+        self.assertEqual((decoder.crc_errors, decoder.framing_errors, decoder.seq_gaps), (0, 0, 0))
+
+    def test_round_trip_random_chunks(self):
+        rng = random.Random(2)
+        sent = []
+        stream = bytearray()
+        for seq in range(300):
+            payload = bytes(rng.choice((0, rng.randrange(256))) for _ in range(rng.randrange(600)))
+            sent.append((seq & 0x7F, seq & 0xFF, payload))
+            stream += encode_frame(seq & 0x7F, seq, payload)
+        decoder = FrameDecoder()
+        received = []
+        pos = 0
+        while pos < len(stream):
+            step = rng.randrange(1, 10)
+            received += decoder.feed(stream[pos:pos + step])
+            pos += step
+        self.assertEqual([(f.type, f.seq, f.payload) for f in received], sent)
+        self.assertEqual(decoder.seq_gaps, 0)
+
+    def test_sequence_gap(self):
+        decoder = FrameDecoder()
+        decoder.feed(encode_frame(1, 10) + encode_frame(1, 11) + encode_frame(1, 14) + encode_frame(1, 15))
+        self.assertEqual((decoder.frames, decoder.seq_gaps), (4, 1))
+
+    def test_sequence_wraps(self):
+        decoder = FrameDecoder()
+        decoder.feed(encode_frame(1, 255) + encode_frame(1, 0))
+        self.assertEqual(decoder.seq_gaps, 0)
+
+    def test_resync_mid_stream(self):
+        # Joining inside a frame: the partial frame is rejected, the next delimiter resynchronises
+        stream = encode_frame(2, 0, b"abcdef") + encode_frame(2, 1, b"ghi")
+        decoder = FrameDecoder()
+        frames = decoder.feed(stream[4:])
+        self.assertEqual([f.payload for f in frames], [b"ghi"])
+        self.assertEqual(decoder.crc_errors + decoder.framing_errors, 1)
+
+    def test_corrupted_byte(self):
+        bad = bytearray(encode_frame(3, 0, b"payload"))
+        bad[4] ^= 0x01
+        decoder = FrameDecoder()
+        frames = decoder.feed(bytes(bad) + encode_frame(3, 1, b"next"))
+        self.assertEqual([f.payload for f in frames], [b"next"])
+        self.assertEqual(decoder.crc_errors, 1)
+
+    def test_dropped_byte(self):
+        bad = encode_frame(3, 0, b"payload")
+        decoder = FrameDecoder()
+        frames = decoder.feed(bad[:3] + bad[4:] + encode_frame(3, 1, b"next"))
+        self.assertEqual([f.payload for f in frames], [b"next"])
+        self.assertEqual(decoder.crc_errors + decoder.framing_errors, 1)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+"""I2C_Timing_Solve() built for the host (gcc) over the 8/36/72 MHz clock trees: python3 -m unittest discover tools"""
+
+import glob
+import os
+import shutil
+import subprocess
+import tempfile
+import unittest
+
+TOOLS = os.path.dirname(os.path.abspath(__file__))
+BAREMETAL = os.path.join(os.path.dirname(TOOLS), "BareMetal")
+
+MODE_STD, MODE_FAST = 0, 1
+
+
+def apb1_clock(sysclk_Hz):
+    """APB1 prescaler of the RCC presets: /1 up to 36 MHz, /2 above (APB1 max 36 MHz)."""
+    return sysclk_Hz if sysclk_Hz <= 36000000 else sysclk_Hz // 2
+
+
+@unittest.skipIf(shutil.which("gcc") is None, "gcc not available")
+class TestI2CTiming(unittest.TestCase):
+    # SYSCLK, requested SCL -> freq_MHz, mode, duty, CCR, TRISE, achieved SCL
+    REFERENCE = [
+        (8000000, 100000, (8, MODE_STD, 0, 40, 9, 100000)),
+        (8000000, 400000, (8, MODE_FAST, 0, 7, 3, 380952)),
+        (36000000, 100000, (36, MODE_STD, 0, 180, 37, 100000)),
+        (36000000, 400000, (36, MODE_FAST, 0, 30, 11, 400000)),
+        (72000000, 100000, (36, MODE_STD, 0, 180, 37, 100000)),
+        (72000000, 400000, (36, MODE_FAST, 0, 30, 11, 400000)),
+    ]
+
+    @classmethod
+    def setUpClass(cls):
+        cls.build = tempfile.mkdtemp()
+        cls.binary = os.path.join(cls.build, "i2c_timing_host")
+        includes = ["-I" + os.path.join(BAREMETAL, "Core", "Inc"), "-I" + os.path.join(BAREMETAL, "Driver")]
+        includes += ["-I" + d for d in sorted(glob.glob(os.path.join(BAREMETAL, "Driver", "*", "Inc")))]
+        subprocess.run(["gcc", "-std=gnu11", "-w", "-DSTM32F103xB"] + includes
+                       + ["-o", cls.binary, os.path.join(TOOLS, "i2c_timing_host.c"),
+                          os.path.join(BAREMETAL, "Driver", "I2C", "Src", "i2c_config.c")], check=True)
+
+    @classmethod
+    def tearDownClass(cls):
+        shutil.rmtree(cls.build, ignore_errors=True)
+
+    def solve(self, *requests):
+        """Runs (APB1 Hz, SCL Hz) requests, returns (achieved, freq_MHz, mode, duty, CCR, TRISE, readback) tuples."""
+        args = [str(value) for request in requests for value in request]
+        out = subprocess.run([self.binary] + args, check=True, capture_output=True, text=True).stdout
+        return [tuple(int(field) for field in line.split()) for line in out.splitlines()]
+
+    def test_clock_trees(self):
+        results = self.solve(*[(apb1_clock(sysclk), speed) for sysclk, speed, _ in self.REFERENCE])
+        for (sysclk, speed, expected), result in zip(self.REFERENCE, results):
+            with self.subTest(sysclk=sysclk, speed=speed):
+                achieved, freq_MHz, mode, duty, ccr, trise, readback = result
+                self.assertEqual((freq_MHz, mode, duty, ccr, trise, achieved), expected)
+                self.assertEqual(readback, achieved)
+                self.assertLessEqual(achieved, speed)
+
+    def test_ccr_field_limit(self):
+        # 36 MHz: 1 kHz needs CCR = 18000 > 0xFFF, the hardware would keep 1616 (~11 kHz)
+        (achieved, _, _, _, ccr, _, _), = self.solve((36000000, 1000))
+        self.assertEqual((achieved, ccr), (0, 0))
+        # Slowest valid speeds: CCR = 4095 at 8 MHz, 4091 at 36 MHz
+        (achieved, _, _, _, ccr, _, _), = self.solve((8000000, 977))
+        self.assertEqual((achieved, ccr), (976, 4095))
+        (achieved, _, _, _, ccr, _, _), = self.solve((36000000, 4400))
+        self.assertEqual((achieved, ccr), (4399, 4091))
+
+    def test_fast_mode_needs_4MHz(self):
+        (achieved, _, _, _, _, _, _), = self.solve((2000000, 400000))
+        self.assertEqual(achieved, 0)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+"""Deferred log decoding tests: python3 -m unittest discover tools"""
+
+import os
+import struct
+import sys
+import unittest
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+from frame_decode import encode_frame
+from log_decode import LOG_FRAME_TYPE, LOG_ID_DROPPED, LogDecoder, format_record, read_section
+
+
+def make_elf(sections):
+    """Minimal 32-bit little endian ELF: section headers only, `sections` = [(name, address, data)]."""
+    names = b"\x00" + b"".join(name.encode() + b"\x00" for name, _, _ in sections) + b".shstrtab\x00"
+    body = bytearray(0x34)
+    headers = [struct.pack("<10I", 0, 0, 0, 0, 0, 0, 0, 0, 0, 0)]
+    name_offset = 1
+    for name, address, data in sections:
+        headers.append(struct.pack("<10I", name_offset, 1, 0, address, len(body), len(data), 0, 0, 1, 0))
+        name_offset += len(name) + 1
+        body += data
+    headers.append(struct.pack("<10I", name_offset, 3, 0, 0, len(body), len(names), 0, 0, 1, 0))
+    body += names
+    shoff = len(body)
+    body[0:16] = b"\x7fELF\x01\x01\x01" + bytes(9)
+    struct.pack_into("<HHIIIIIHHHHHH", body, 16, 2, 40, 1, 0, 0, shoff, 0, 0x34, 0, 0, 40, len(headers), len(headers) - 1)
+    return bytes(body) + b"".join(headers)
+
+
+def header(fmt_id, level, nargs):
+    return (fmt_id << 8) | (level << 4) | nargs
+
+
+def record(seq, fmt_id, level, *args):
+    payload = struct.pack("<%uI" % (len(args) + 1), header(fmt_id, level, len(args)), *args)
+    return encode_frame(LOG_FRAME_TYPE, seq, payload)
+
+
+# `.log_fmt` placed at address 0 by the linker script: IDs are offsets
+FORMATS = b"boot v%u.%u\x00temp %d C, adc 0x%04X\x00ratio %.2f\x00"
+BOOT, TEMP, RATIO = 0, FORMATS.index(b"temp"), FORMATS.index(b"ratio")
+
+
+class TestFormat(unittest.TestCase):
+    def test_conversions(self):
+        self.assertEqual(format_record("%d %i %u", [0xFFFFFFFF, 5, 0xFFFFFFFF]), "-1 5 4294967295")
+        self.assertEqual(format_record("%x %08X %c%c", [0xBEEF, 0xBEEF, 0x4F, 0x4B]), "beef 0000BEEF OK")
+        self.assertEqual(format_record("%p %lu %%", [0x20000000, 7]), "0x20000000 7 %")
+        self.assertEqual(format_record("%.3f", [struct.unpack("<I", struct.pack("<f", 1.5))[0]]), "1.500")
+        self.assertEqual(format_record("%*d|", [4, 2]), "   2|")
+
+    def test_missing_argument(self):
+        self.assertEqual(format_record("%d %d", [1]), "1 <?>")
+
+
+class TestLogDecoder(unittest.TestCase):
+    def setUp(self):
+        self.elf = make_elf([(".text", 0x08000000, b"\x00" * 16), (".log_fmt", 0, FORMATS)])
+
+    def test_read_section(self):
+        self.assertEqual(read_section(self.elf, ".log_fmt"), (0, FORMATS))
+        with self.assertRaises(ValueError):
+            read_section(self.elf, ".missing")
+
+    def test_records(self):
+        decoder = LogDecoder(self.elf)
+        stream = (record(0, BOOT, 3, 1, 2) + record(1, TEMP, 2, 0xFFFFFFF6, 0x3FF)
+                  + record(2, RATIO, 4, struct.unpack("<I", struct.pack("<f", 0.25))[0]))
+        self.assertEqual(decoder.feed(stream), ["INFO  boot v1.2", "WARN  temp -10 C, adc 0x03FF", "DEBUG ratio 0.25"])
+
+    def test_flash_placement(self):
+        # Without the linker script entry the strings stay in FLASH: IDs are the low 24 bits of the address
+        decoder = LogDecoder(make_elf([(".log_fmt", 0x08001000, FORMATS)]))
+        self.assertEqual(decoder.feed(record(0, 0x001000 + BOOT, 1, 3, 4)), ["ERROR boot v3.4"])
+
+    def test_dropped_and_gaps(self):
+        decoder = LogDecoder(self.elf)
+        lines = decoder.feed(record(0, LOG_ID_DROPPED, 2, 5) + record(3, BOOT, 3, 1, 0))
+        self.assertEqual(lines, ["WARN  5 records dropped (log ring full)", "INFO  boot v1.0"])
+        self.assertEqual((decoder.dropped, decoder.frames.seq_gaps), (5, 1))
+
+    def test_resync_and_other_frames(self):
+        decoder = LogDecoder(self.elf)
+        # Joined mid-record, then a non log frame on the same link
+        stream = record(0, TEMP, 2, 1, 2)[5:] + encode_frame(0x01, 1, b"xyz") + record(2, BOOT, 3, 9, 9)
+        self.assertEqual(decoder.feed(stream), ["INFO  boot v9.9"])
+
+    def test_bad_records(self):
+        decoder = LogDecoder(self.elf)
+        lines = decoder.feed(encode_frame(LOG_FRAME_TYPE, 0, b"\x01\x02\x03")
+                             + encode_frame(LOG_FRAME_TYPE, 1, struct.pack("<I", header(BOOT, 3, 2)))
+                             + record(2, 0x7FFF, 3))
+        self.assertTrue(lines[0].startswith("<bad record"))
+        self.assertTrue(lines[1].startswith("<bad record"))
+        self.assertEqual(lines[2], "INFO  <unknown format id 0x007fff>")
+        self.assertEqual(decoder.bad_records, 3)
+
+
+if __name__ == "__main__":
+    unittest.main()